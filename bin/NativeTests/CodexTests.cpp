@@ -287,4 +287,101 @@ namespace CodexTest
         
         RunUtf8DecodeTestCase(testCases, utf8::DecodeUnitsIntoAndNullTerminateNoAdvance);
     }
+
+    TEST_CASE("CodexTest_CharacterIndexToByteIndex_LongAsciiRuns", "[CodexTest]")
+    {
+        // ASCII runs longer than the block size of the fast paths, with multi-byte characters
+        // placed at every offset within and around a block.
+        const size_t asciiRunLength = 40;
+        const utf8char_t multiByteChar[] = { 0xe3, 0x81, 0x82 }; // U+3042
+
+        for (size_t position = 0; position <= asciiRunLength; position++)
+        {
+            utf8char_t source[asciiRunLength * 2 + sizeof(multiByteChar)];
+            size_t cbSource = 0;
+            for (size_t i = 0; i < position; i++)
+            {
+                source[cbSource++] = 'a';
+            }
+            for (size_t i = 0; i < sizeof(multiByteChar); i++)
+            {
+                source[cbSource++] = multiByteChar[i];
+            }
+            for (size_t i = 0; i < asciiRunLength; i++)
+            {
+                source[cbSource++] = 'b';
+            }
+
+            for (charcount_t cch = 0; cch <= asciiRunLength + 1 + position; cch++)
+            {
+                size_t expectedByteIndex = cch <= position ? cch : cch + sizeof(multiByteChar) - 1;
+                CHECK(utf8::CharacterIndexToByteIndex(source, cbSource, cch, utf8::doDefault) == expectedByteIndex);
+                CHECK(utf8::ByteIndexIntoCharacterIndex(source, expectedByteIndex, utf8::doDefault) == cch);
+            }
+        }
+    }
+
+    TEST_CASE("CodexTest_IsAsciiOnly", "[CodexTest]")
+    {
+        const size_t cbSource = 40;
+        utf8char_t source[cbSource];
+        for (size_t i = 0; i < cbSource; i++)
+        {
+            source[i] = (utf8char_t)('a' + i % 26);
+        }
+
+        CHECK(utf8::IsAsciiOnly(source, 0));
+        CHECK(utf8::IsAsciiOnly(source, cbSource));
+
+        // A single non-ASCII byte at any offset, inside or past a whole block, is found
+        for (size_t position = 0; position < cbSource; position++)
+        {
+            utf8char_t saved = source[position];
+            source[position] = 0x80;
+            CHECK(!utf8::IsAsciiOnly(source, cbSource));
+            CHECK(utf8::IsAsciiOnly(source, position));
+            source[position] = saved;
+        }
+    }
+
+    TEST_CASE("CodexTest_DecodeAndEncode_LongAsciiRuns", "[CodexTest]")
+    {
+        // Round trip ASCII runs longer than the block size of the fast paths, with a 2-byte
+        // character placed at every offset within and around a block.
+        const size_t asciiRunLength = 40;
+        const utf8char_t multiByteChar[] = { 0xc3, 0xa9 }; // U+00E9
+
+        for (size_t position = 0; position <= asciiRunLength; position++)
+        {
+            utf8char_t source[asciiRunLength * 2 + sizeof(multiByteChar)];
+            char16 expected[asciiRunLength * 2 + 1];
+            size_t cbSource = 0;
+            size_t cchExpected = 0;
+            for (size_t i = 0; i < position; i++)
+            {
+                source[cbSource++] = (utf8char_t)('a' + i % 26);
+                expected[cchExpected++] = (char16)('a' + i % 26);
+            }
+            source[cbSource++] = multiByteChar[0];
+            source[cbSource++] = multiByteChar[1];
+            expected[cchExpected++] = 0xe9;
+            for (size_t i = 0; i < asciiRunLength; i++)
+            {
+                source[cbSource++] = (utf8char_t)('A' + i % 26);
+                expected[cchExpected++] = (char16)('A' + i % 26);
+            }
+
+            char16 decoded[asciiRunLength * 2 + 1];
+            LPCUTF8 pbSource = source;
+            size_t cchDecoded = utf8::DecodeUnitsInto(decoded, pbSource, source + cbSource, utf8::doDefault);
+            CHECK(cchDecoded == cchExpected);
+            CHECK(pbSource == source + cbSource);
+            CHECK(memcmp(decoded, expected, cchExpected * sizeof(char16)) == 0);
+
+            utf8char_t encoded[(asciiRunLength * 2 + 1) * 3];
+            size_t cbEncoded = utf8::EncodeInto<utf8::Utf8EncodingKind::TrueUtf8>(encoded, sizeof(encoded), expected, (charcount_t)cchExpected);
+            CHECK(cbEncoded == cbSource);
+            CHECK(memcmp(encoded, source, cbSource) == 0);
+        }
+    }
 };
@@ -90,5 +90,122 @@ namespace JsDiagApiTest
     {
         JsDiagApiTest::WithSetup(JsDiagApiTest::BreakpointsContextTest);
     }
+
+    static LPCSTR readOnlySerializedScript =
+        "function outer(a) {\n"
+        "    function inner(b) {\n"
+        "        return a + b;\n"
+        "    }\n"
+        "    return inner(1);\n"
+        "}\n"
+        "outer;";
+
+    static void CALLBACK CountBreakpointsCallback(JsDiagDebugEvent debugEvent, JsValueRef eventData, void* callbackState)
+    {
+        if (debugEvent == JsDiagDebugEventBreakpoint)
+        {
+            ++*(int*)callbackState;
+        }
+    }
+
+    static int CallOuter(JsValueRef outer)
+    {
+        JsValueRef undefined = JS_INVALID_REFERENCE;
+        REQUIRE(JsGetUndefinedValue(&undefined) == JsNoError);
+        JsValueRef arg = JS_INVALID_REFERENCE;
+        REQUIRE(JsIntToNumber(41, &arg) == JsNoError);
+
+        JsValueRef args[] = { undefined, arg };
+        JsValueRef result = JS_INVALID_REFERENCE;
+        REQUIRE(JsCallFunction(outer, args, _countof(args), &result) == JsNoError);
+
+        int intValue = 0;
+        REQUIRE(JsNumberToInt(result, &intValue) == JsNoError);
+        return intValue;
+    }
+
+    TEST_CASE("JsDiagApiTest_BreakpointOnReadOnlySerializedScript", "[JsDiagApiTest]")
+    {
+        JsRuntimeHandle runtime = JS_INVALID_RUNTIME_HANDLE;
+        JsContextRef context = JS_INVALID_REFERENCE;
+        REQUIRE(JsCreateRuntime(JsRuntimeAttributeNone, nullptr, &runtime) == JsNoError);
+        REQUIRE(JsCreateContext(runtime, &context) == JsNoError);
+        REQUIRE(JsSetCurrentContext(context) == JsNoError);
+
+        // Scripts can't be serialized in debug mode, so serialize before the debugger attaches
+        JsValueRef script = JS_INVALID_REFERENCE;
+        REQUIRE(JsCreateString(readOnlySerializedScript, strlen(readOnlySerializedScript), &script) == JsNoError);
+        JsValueRef buffer = JS_INVALID_REFERENCE;
+        REQUIRE(JsSerialize(script, &buffer, JsParseScriptAttributeNone) == JsNoError);
+
+        BYTE *bcBuffer = nullptr;
+        unsigned int bcBufferSize = 0;
+        REQUIRE(JsGetArrayBufferStorage(buffer, &bcBuffer, &bcBufferSize) == JsNoError);
+
+        BYTE *readOnlyBuffer = (BYTE*)VirtualAlloc(nullptr, bcBufferSize, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+        REQUIRE(readOnlyBuffer != nullptr);
+        memcpy(readOnlyBuffer, bcBuffer, bcBufferSize);
+        DWORD oldProtect;
+        REQUIRE(VirtualProtect(readOnlyBuffer, bcBufferSize, PAGE_READONLY, &oldProtect));
+
+        JsValueRef readOnlyBufferRef = JS_INVALID_REFERENCE;
+        REQUIRE(JsCreateExternalArrayBuffer(readOnlyBuffer, bcBufferSize,
+            [](void *data)
+        {
+            VirtualFree(data, 0, MEM_RELEASE);
+        }, readOnlyBuffer, &readOnlyBufferRef) == JsNoError);
+
+        JsValueRef sourceUrl = JS_INVALID_REFERENCE;
+        REQUIRE(JsCreateString("", 0, &sourceUrl) == JsNoError);
+
+        JsValueRef outer = JS_INVALID_REFERENCE;
+        REQUIRE(JsRunSerialized(readOnlyBufferRef,
+            [](JsSourceContext sourceContext, JsValueRef *value, JsParseScriptAttributes *parseAttributes)
+        {
+            *parseAttributes = JsParseScriptAttributeNone;
+            return JsCreateExternalArrayBuffer((void*)readOnlySerializedScript, (unsigned int)strlen(readOnlySerializedScript), nullptr, nullptr, value) == JsNoError;
+        }, JS_SOURCE_CONTEXT_NONE, sourceUrl, &outer) == JsNoError);
+
+        // Deserialize both functions while their byte code is still used in place
+        CHECK(CallOuter(outer) == 42);
+
+        int breakpointsHit = 0;
+        REQUIRE(JsDiagStartDebugging(runtime, JsDiagApiTest::CountBreakpointsCallback, &breakpointsHit) == JsNoError);
+
+        JsValueRef scripts = JS_INVALID_REFERENCE;
+        REQUIRE(JsDiagGetScripts(&scripts) == JsNoError);
+        JsValueRef index = JS_INVALID_REFERENCE;
+        REQUIRE(JsIntToNumber(0, &index) == JsNoError);
+        JsValueRef scriptInfo = JS_INVALID_REFERENCE;
+        REQUIRE(JsGetIndexedProperty(scripts, index, &scriptInfo) == JsNoError);
+        JsPropertyIdRef scriptIdProperty = JS_INVALID_REFERENCE;
+        REQUIRE(JsGetPropertyIdFromName(_u("scriptId"), &scriptIdProperty) == JsNoError);
+        JsValueRef scriptIdValue = JS_INVALID_REFERENCE;
+        REQUIRE(JsGetProperty(scriptInfo, scriptIdProperty, &scriptIdValue) == JsNoError);
+        int scriptId = 0;
+        REQUIRE(JsNumberToInt(scriptIdValue, &scriptId) == JsNoError);
+
+        // Break on "return a + b;" in inner. Writing the probe into the read-only pages would fault.
+        JsValueRef breakpoint = JS_INVALID_REFERENCE;
+        REQUIRE(JsDiagSetBreakpoint((unsigned int)scriptId, 2, 8, &breakpoint) == JsNoError);
+
+        CHECK(CallOuter(outer) == 42);
+        CHECK(breakpointsHit == 1);
+        CHECK(memcmp(readOnlyBuffer, bcBuffer, bcBufferSize) == 0);
+
+        JsPropertyIdRef breakpointIdProperty = JS_INVALID_REFERENCE;
+        REQUIRE(JsGetPropertyIdFromName(_u("breakpointId"), &breakpointIdProperty) == JsNoError);
+        JsValueRef breakpointIdValue = JS_INVALID_REFERENCE;
+        REQUIRE(JsGetProperty(breakpoint, breakpointIdProperty, &breakpointIdValue) == JsNoError);
+        int breakpointId = 0;
+        REQUIRE(JsNumberToInt(breakpointIdValue, &breakpointId) == JsNoError);
+        CHECK(JsDiagRemoveBreakpoint((unsigned int)breakpointId) == JsNoError);
+        CHECK(CallOuter(outer) == 42);
+        CHECK(breakpointsHit == 1);
+
+        JsDiagStopDebugging(runtime, nullptr);
+        JsSetCurrentContext(nullptr);
+        JsDisposeRuntime(runtime);
+    }
 #endif // BUILD_WITHOUT_SCRIPT_DEBUG
 }
@@ -9,6 +9,7 @@
 #pragma warning(disable:26495) // Uninitialized member variable
 #include "catch.hpp"
 #include <array>
+#include <string>
 #include <process.h>
 #include <suppress.h>
 
@@ -73,6 +74,8 @@ namespace JsRTApiTest
         WithSetup(JsRuntimeAttributeEnableIdleProcessing, handler);
         WithSetup(JsRuntimeAttributeDisableNativeCodeGeneration, handler);
         WithSetup(JsRuntimeAttributeDisableExecutablePageAllocation, handler);
+        WithSetup(JsRuntimeAttributeDisableDynamicInterpreterThunks, handler);
+        WithSetup(JsRuntimeAttributeEnableStringInterning, handler);
         WithSetup(JsRuntimeAttributeDisableEval, handler);
         WithSetup((JsRuntimeAttributes)(JsRuntimeAttributeDisableBackgroundWork | JsRuntimeAttributeAllowScriptInterrupt | JsRuntimeAttributeEnableIdleProcessing), handler);
     }
@@ -2668,6 +2671,107 @@ namespace JsRTApiTest
         JsRTApiTest::RunWithAttributes(JsRTApiTest::JsLessThanTest);
     }
 
+    void LargeFunctionJitQueueTest(JsRuntimeAttributes attributes, JsRuntimeHandle runtime)
+    {
+        // A function above the large function bytecode count gets queued for full JIT behind the small hot functions.
+        // It has to keep producing the right result while it waits and after it's jitted.
+        std::string script = "function large(a) {";
+        for (int i = 0; i < 7000; i++)
+        {
+            script += " a = (a * 31 + " + std::to_string(i) + ") | 0;";
+        }
+        script +=
+            " return a; }"
+            "function expected(a) { for (var i = 0; i < 7000; i++) { a = (a * 31 + i) | 0; } return a; }"
+            "function add(a, b) { return a + b; }"
+            "function mul(a, b) { return a * b; }"
+            "function mix(a, b) { return (a ^ b) + (a & b); }"
+            "(function () {"
+            "  for (var n = 0; n < 300; n++) {"
+            "    for (var k = 0; k < 200; k++) { if (add(k, n) !== k + n || mul(k, 2) !== k * 2 || mix(k, n) !== ((k ^ n) + (k & n))) return false; }"
+            "    if (large(n) !== expected(n)) return false;"
+            "  }"
+            "  return true;"
+            "})()";
+
+        JsValueRef sourceUrl = JS_INVALID_REFERENCE, scriptRef = JS_INVALID_REFERENCE, result = JS_INVALID_REFERENCE;
+        REQUIRE(JsCreateString("", 0, &sourceUrl) == JsNoError);
+        REQUIRE(JsCreateString(script.c_str(), script.length(), &scriptRef) == JsNoError);
+        REQUIRE(JsRun(scriptRef, JS_SOURCE_CONTEXT_NONE, sourceUrl, JsParseScriptAttributeNone, &result) == JsNoError);
+
+        bool passed = false;
+        REQUIRE(JsBooleanToBool(result, &passed) == JsNoError);
+        CHECK(passed);
+    }
+
+    TEST_CASE("ApiTest_LargeFunctionJitQueueTest", "[ApiTest]")
+    {
+        JsRTApiTest::RunWithAttributes(JsRTApiTest::LargeFunctionJitQueueTest);
+    }
+
+    void ScannerSourceEndTest(JsRuntimeAttributes attributes, JsRuntimeHandle runtime)
+    {
+        // Sources that end inside an identifier, string, template or comment, at every length around the vector
+        // width, must parse (or fail to parse) the same way through both the UTF-8 and the UTF-16 scanner
+        struct SourceShape
+        {
+            const char *prefix;
+            const char *suffix;
+            JsErrorCode expected;
+        };
+        const SourceShape shapes[] =
+        {
+            { "var ", "", JsNoError },
+            { "'", "", JsErrorScriptCompile },
+            { "\"", "\"", JsNoError },
+            { "`", "", JsErrorScriptCompile },
+            { "/*", "", JsErrorScriptCompile },
+            { "//", "", JsNoError },
+        };
+
+        JsValueRef sourceUrl = JS_INVALID_REFERENCE;
+        REQUIRE(JsCreateString("", 0, &sourceUrl) == JsNoError);
+
+        for (const SourceShape &shape : shapes)
+        {
+            for (size_t length = 1; length <= 40; length++)
+            {
+                std::string source = shape.prefix;
+                source.append(length, 'a');
+                source += shape.suffix;
+                // Name the source in the report of any check below that fails
+                INFO("source: " << source);
+
+                JsValueRef utf8Script = JS_INVALID_REFERENCE, utf16Script = JS_INVALID_REFERENCE, result = JS_INVALID_REFERENCE, exception = JS_INVALID_REFERENCE;
+                // The script keeps referring to its external buffer, so give it a copy it frees itself
+                char *utf8Source = new char[source.length() + 1];
+                memcpy(utf8Source, source.c_str(), source.length() + 1);
+                REQUIRE(JsCreateExternalArrayBuffer(utf8Source, (unsigned int)source.length(),
+                    [](void *data)
+                {
+                    delete[] (char*)data;
+                }, utf8Source, &utf8Script) == JsNoError);
+                CHECK(JsParse(utf8Script, JS_SOURCE_CONTEXT_NONE, sourceUrl, JsParseScriptAttributeNone, &result) == shape.expected);
+                if (shape.expected != JsNoError)
+                {
+                    REQUIRE(JsGetAndClearException(&exception) == JsNoError);
+                }
+
+                REQUIRE(JsCreateString(source.data(), source.length(), &utf16Script) == JsNoError);
+                CHECK(JsParse(utf16Script, JS_SOURCE_CONTEXT_NONE, sourceUrl, JsParseScriptAttributeNone, &result) == shape.expected);
+                if (shape.expected != JsNoError)
+                {
+                    REQUIRE(JsGetAndClearException(&exception) == JsNoError);
+                }
+            }
+        }
+    }
+
+    TEST_CASE("ApiTest_ScannerSourceEndTest", "[ApiTest]")
+    {
+        JsRTApiTest::RunWithAttributes(JsRTApiTest::ScannerSourceEndTest);
+    }
+
     void JsCreateStringTest(JsRuntimeAttributes attributes, JsRuntimeHandle runtime)
     {
         // Passing in invalid utf8 sequences should result in the unicode replacement character
@@ -2688,6 +2792,50 @@ namespace JsRTApiTest
         REQUIRE(JsCopyString(result,utf8Result, 10, &written) == JsNoError);
         CHECK(written == strlen(validUtf8Input));
         CHECK(memcmp(utf8Result, validUtf8Input, written) == 0);
+
+        // ASCII input is kept one byte per character; every copy API and script use must see the same characters
+        const char asciiInput[] = "content-type";
+        const size_t asciiLength = strlen(asciiInput);
+        REQUIRE(JsCreateString(asciiInput, asciiLength, &result) == JsNoError);
+        char oneByteResult[16] = { 0 };
+        REQUIRE(JsCopyStringOneByte(result, 8, 10, oneByteResult, &written) == JsNoError);
+        CHECK(written == 4);
+        CHECK(memcmp(oneByteResult, "type", 4) == 0);
+        uint16_t utf16AsciiResult[16];
+        REQUIRE(JsCopyStringUtf16(result, 0, 16, utf16AsciiResult, &written) == JsNoError);
+        CHECK(written == asciiLength);
+        for (size_t i = 0; i < asciiLength; i++)
+        {
+            CHECK(utf16AsciiResult[i] == (uint16_t)asciiInput[i]);
+        }
+
+        JsValueRef global, concatenated;
+        JsPropertyIdRef headerId;
+        bool isExpected;
+        REQUIRE(JsCreateString(asciiInput, asciiLength, &result) == JsNoError);
+        REQUIRE(JsGetGlobalObject(&global) == JsNoError);
+        REQUIRE(JsGetPropertyIdFromName(_u("header"), &headerId) == JsNoError);
+        REQUIRE(JsSetProperty(global, headerId, result, false) == JsNoError);
+        REQUIRE(JsRunScript(_u("(header + '/' + header) === 'content-type/content-type'"), JS_SOURCE_CONTEXT_NONE, _u(""), &concatenated) == JsNoError);
+        REQUIRE(JsBooleanToBool(concatenated, &isExpected) == JsNoError);
+        CHECK(isExpected);
+
+        // Host strings used as property keys must find the same property as script literals, on every use
+        JsValueRef headers, count;
+        REQUIRE(JsCreateObject(&headers) == JsNoError);
+        REQUIRE(JsIntToNumber(1, &count) == JsNoError);
+        REQUIRE(JsCreateString(asciiInput, asciiLength, &result) == JsNoError);
+        REQUIRE(JsSetIndexedProperty(headers, result, count) == JsNoError);
+        REQUIRE(JsSetProperty(global, headerId, result, false) == JsNoError);
+        JsPropertyIdRef headersId;
+        REQUIRE(JsGetPropertyIdFromName(_u("headers"), &headersId) == JsNoError);
+        REQUIRE(JsSetProperty(global, headersId, headers, false) == JsNoError);
+        REQUIRE(JsRunScript(_u("for (var i = 0; i < 50; i++) { headers[header]++; } headers['content-type'] === 51 && Object.keys(headers).length === 1"), JS_SOURCE_CONTEXT_NONE, _u(""), &concatenated) == JsNoError);
+        REQUIRE(JsBooleanToBool(concatenated, &isExpected) == JsNoError);
+        CHECK(isExpected);
+        REQUIRE(JsCopyStringOneByte(result, 0, 16, oneByteResult, &written) == JsNoError);
+        CHECK(written == asciiLength);
+        CHECK(memcmp(oneByteResult, asciiInput, asciiLength) == 0);
     }
 
     TEST_CASE("ApiTest_JsCreateStringTest", "[ApiTest]")
@@ -2695,6 +2843,428 @@ namespace JsRTApiTest
         JsRTApiTest::RunWithAttributes(JsRTApiTest::JsCreateStringTest);
     }
 
+    void JsParseJsonTest(JsRuntimeAttributes attributes, JsRuntimeHandle runtime)
+    {
+        // Long enough for the type cache, with escapes and a non-ASCII character in a long string
+        const char json[] = "{\"name\": \"caf\xc3\xa9 \\\"latte\\\" \\u0041 plain text longer than a vector\", \"list\": [1, -2.5, true, null], \"nested\": {\"name\": \"x\"}}";
+        JsValueRef result = JS_INVALID_REFERENCE;
+        REQUIRE(JsParseJson(json, static_cast<size_t>(-1), &result) == JsNoError);
+
+        JsValueRef global, check;
+        JsPropertyIdRef parsedId;
+        bool isExpected = false;
+        REQUIRE(JsGetGlobalObject(&global) == JsNoError);
+        REQUIRE(JsGetPropertyIdFromName(_u("parsed"), &parsedId) == JsNoError);
+        REQUIRE(JsSetProperty(global, parsedId, result, false) == JsNoError);
+        REQUIRE(JsRunScript(_u(
+            "parsed.name === 'caf\\u00e9 \"latte\" A plain text longer than a vector' &&"
+            "parsed.list.length === 4 && parsed.list[1] === -2.5 && parsed.list[3] === null &&"
+            "parsed.nested.name === 'x'"), JS_SOURCE_CONTEXT_NONE, _u(""), &check) == JsNoError);
+        REQUIRE(JsBooleanToBool(check, &isExpected) == JsNoError);
+        CHECK(isExpected);
+
+        // Invalid JSON reports a SyntaxError through the exception state
+        const char badJson[] = "{\"a\": [1, 2}";
+        CHECK(JsParseJson(badJson, strlen(badJson), &result) == JsErrorScriptException);
+        CHECK(result == JS_INVALID_REFERENCE);
+        JsValueRef exception = JS_INVALID_REFERENCE;
+        REQUIRE(JsGetAndClearException(&exception) == JsNoError);
+        CHECK(exception != JS_INVALID_REFERENCE);
+    }
+
+    TEST_CASE("ApiTest_JsParseJsonTest", "[ApiTest]")
+    {
+        JsRTApiTest::RunWithAttributes(JsRTApiTest::JsParseJsonTest);
+    }
+
+    void JsStringifyToBufferTest(JsRuntimeAttributes attributes, JsRuntimeHandle runtime)
+    {
+        // Same-shaped objects, including one whose value is skipped, with escapes and non-ASCII text
+        JsValueRef value = JS_INVALID_REFERENCE;
+        REQUIRE(JsRunScript(_u(
+            "[{id: 1, name: 'a\\"b', tag: 'caf\\u00e9'},"
+            " {id: 2, name: '\\ud83d\\ude00', tag: '\\n'},"
+            " {id: 3, name: 'x', tag: undefined}]"), JS_SOURCE_CONTEXT_NONE, _u(""), &value) == JsNoError);
+
+        const char expected[] = "[{\"id\":1,\"name\":\"a\\\"b\",\"tag\":\"caf\xc3\xa9\"},"
+            "{\"id\":2,\"name\":\"\xf0\x9f\x98\x80\",\"tag\":\"\\n\"},"
+            "{\"id\":3,\"name\":\"x\"}]";
+        const size_t expectedLength = strlen(expected);
+
+        // A null buffer only reports the size
+        size_t written = 0;
+        size_t length = 0;
+        REQUIRE(JsStringifyToBuffer(value, nullptr, 0, &written, &length) == JsNoError);
+        CHECK(length == expectedLength);
+        CHECK(written == 0);
+
+        char buffer[256];
+        REQUIRE(JsStringifyToBuffer(value, buffer, sizeof(buffer), &written, &length) == JsNoError);
+        CHECK(length == expectedLength);
+        REQUIRE(written == expectedLength);
+        CHECK(memcmp(buffer, expected, expectedLength) == 0);
+
+        // A buffer ending inside a multi-byte character is cut before that character
+        const size_t emojiOffset = strstr(expected, "\xf0") - expected;
+        REQUIRE(JsStringifyToBuffer(value, buffer, emojiOffset + 2, &written, &length) == JsNoError);
+        CHECK(length == expectedLength);
+        CHECK(written == emojiOffset);
+        CHECK(memcmp(buffer, expected, emojiOffset) == 0);
+
+        // Values without a JSON representation produce no text
+        JsValueRef undefinedValue = JS_INVALID_REFERENCE;
+        REQUIRE(JsGetUndefinedValue(&undefinedValue) == JsNoError);
+        REQUIRE(JsStringifyToBuffer(undefinedValue, buffer, sizeof(buffer), &written, &length) == JsNoError);
+        CHECK(length == 0);
+        CHECK(written == 0);
+
+        // Serialization errors surface as script exceptions
+        REQUIRE(JsRunScript(_u("var cycle = {}; cycle.self = cycle; cycle"), JS_SOURCE_CONTEXT_NONE, _u(""), &value) == JsNoError);
+        CHECK(JsStringifyToBuffer(value, buffer, sizeof(buffer), &written, &length) == JsErrorScriptException);
+        JsValueRef exception = JS_INVALID_REFERENCE;
+        REQUIRE(JsGetAndClearException(&exception) == JsNoError);
+    }
+
+    TEST_CASE("ApiTest_JsStringifyToBufferTest", "[ApiTest]")
+    {
+        JsRTApiTest::RunWithAttributes(JsRTApiTest::JsStringifyToBufferTest);
+    }
+
+    void StringAppendLoopTest(JsRuntimeAttributes attributes, JsRuntimeHandle runtime)
+    {
+        // Appends of short strings in a hot loop are copied into the left string's last block by the JIT;
+        // every right operand length up to the inline limit and just past it must give the same result as join.
+        // The script returns the index in all[] of the first piece whose loop went wrong, or -1.
+        JsValueRef result = JS_INVALID_REFERENCE;
+        REQUIRE(JsRunScript(_u(
+            "(function () {"
+            "  function append(pieces, count) {"
+            "    var s = '';"
+            "    for (var i = 0; i < count; i++) { s += pieces[i % pieces.length]; }"
+            "    return s;"
+            "  }"
+            "  var all = ['', 'a', 'bc', 'def', 'ghij', 'klmno', 'pqrstu', 'vwxyz01', '23456789', '\\u00e9\\u4e2d\\ud83d\\ude00!?#@+'];"
+            "  for (var len = 0; len < all.length; len++) {"
+            "    var pieces = [all[len], all[(len + 1) % all.length], all[len]];"
+            "    for (var round = 0; round < 60; round++) {"
+            "      var count = 200 + round;"
+            "      var expected = [];"
+            "      for (var i = 0; i < count; i++) { expected.push(pieces[i % pieces.length]); }"
+            "      var s = append(pieces, count);"
+            "      if (s !== expected.join('') || s.length !== expected.join('').length) return len;"
+            "    }"
+            "  }"
+            "  return -1;"
+            "})()"), JS_SOURCE_CONTEXT_NONE, _u(""), &result) == JsNoError);
+
+        int failedPiece = 0;
+        REQUIRE(JsNumberToInt(result, &failedPiece) == JsNoError);
+        CHECK(failedPiece == -1);
+    }
+
+    TEST_CASE("ApiTest_StringAppendLoopTest", "[ApiTest]")
+    {
+        JsRTApiTest::RunWithAttributes(JsRTApiTest::StringAppendLoopTest);
+    }
+
+    void StringTreeReadTest(JsRuntimeAttributes attributes, JsRuntimeHandle runtime)
+    {
+        // Character and substring reads on concatenated strings that haven't been flattened must match
+        // the same reads on a flat copy, whether the range falls inside one part or spans several.
+        // The script returns 0, or check * 100 + maker for the first check that failed.
+        JsValueRef result = JS_INVALID_REFERENCE;
+        REQUIRE(JsRunScript(_u(
+            "(function () {"
+            "  var p = ['alpha', 'be', 'gamma-delta', 'xy', 'epsilon'];"
+            "  var makers = ["
+            "    function () { return p[0] + p[1]; },"
+            "    function () { return p[2] + (p[3] + p[4]); },"
+            "    function () { return (p[0] + p[1]) + (p[2] + p[3]); },"
+            "    function () { return `${p[0]}:${p[2]}:${p[4]}`; },"
+            "    function () { return '[' + (p[0] + p[1]) + ']'; },"
+            "    function () { var s = ''; for (var i = 0; i < 40; i++) { s = p[i % 5] + s; } return s; },"
+            "    function () { var s = ''; for (var i = 0; i < 40; i++) { s += p[i % 5]; } return s; }"
+            "  ];"
+            "  for (var m = 0; m < makers.length; m++) {"
+            "    var flat = makers[m]().split('').join('');"
+            "    var tree = makers[m]();"
+            "    for (var i = 0; i <= flat.length; i++) {"
+            "      if (tree.charAt(i) !== flat.charAt(i)) return 100 + m;"
+            "      var code = tree.charCodeAt(i);"
+            "      if (code !== flat.charCodeAt(i) && !(isNaN(code) && i === flat.length)) return 200 + m;"
+            "    }"
+            "    var len = Math.min(flat.length, 30);"
+            "    for (var start = 0; start < len; start++) {"
+            "      for (var end = start; end <= len; end++) {"
+            "        if (makers[m]().substring(start, end) !== flat.substring(start, end)) return 300 + m;"
+            "        if (makers[m]().slice(start - flat.length, end) !== flat.slice(start - flat.length, end)) return 400 + m;"
+            "      }"
+            "    }"
+            "    if (tree !== flat) return 500 + m;"
+            "  }"
+            "  return 0;"
+            "})()"), JS_SOURCE_CONTEXT_NONE, _u(""), &result) == JsNoError);
+
+        int failedCheck = -1;
+        REQUIRE(JsNumberToInt(result, &failedCheck) == JsNoError);
+        CHECK(failedCheck == 0);
+    }
+
+    TEST_CASE("ApiTest_StringTreeReadTest", "[ApiTest]")
+    {
+        JsRTApiTest::RunWithAttributes(JsRTApiTest::StringTreeReadTest);
+    }
+
+    void StringInterningTest(JsRuntimeAttributes attributes, JsRuntimeHandle runtime)
+    {
+        // Repeated short JSON values and split pieces may be shared between results when the host enables
+        // interning; they must still compare, index and key like independently created strings, including
+        // after a collection. The script returns 0, or the number of the first check that failed.
+        JsValueRef check = JS_INVALID_REFERENCE;
+        REQUIRE(JsRunScript(_u(
+            "var check = function () {"
+            "  var expected = ['active', 'inactive', 'pending-review', 'tab\\tbed', 'x'.repeat(40), 'ab'];"
+            "  var items = [];"
+            "  for (var i = 0; i < 300; i++) { items.push('{\"status\":' + JSON.stringify(expected[i % 6]) + ',\"id\":\"id' + i + '\"}'); }"
+            "  var doc = JSON.parse('[' + items.join(',') + ']');"
+            "  var counts = {};"
+            "  for (var i = 0; i < doc.length; i++) {"
+            "    if (doc[i].status !== expected[i % 6] || doc[i].id !== 'id' + i) return 1;"
+            "    if (doc[i].status.length !== expected[i % 6].length || doc[i].status.charAt(1) !== expected[i % 6].charAt(1)) return 2;"
+            "    counts[doc[i].status] = (counts[doc[i].status] || 0) + 1;"
+            "  }"
+            "  if (Object.keys(counts).length !== 6 || counts['active'] !== 50) return 3;"
+            "  var line = 'red,green,,blue,green,red,' + 'y'.repeat(50) + ',gr';"
+            "  var pieces = ['red', 'green', '', 'blue', 'green', 'red', 'y'.repeat(50), 'gr'];"
+            "  for (var r = 0; r < 20; r++) {"
+            "    var a = line.split(','), b = line.split(/,/), c = line.split(',', 3);"
+            "    if (a.length !== pieces.length || b.length !== pieces.length || c.length !== 3) return 4;"
+            "    for (var j = 0; j < pieces.length; j++) {"
+            "      if (a[j] !== pieces[j]) return 5;"
+            "      if (b[j] !== pieces[j]) return 6;"
+            "      if (j < 3 && c[j] !== pieces[j]) return 7;"
+            "    }"
+            "  }"
+            "  if (JSON.parse('[\"green\",\"gr\"]')[0] !== a[1]) return 8;"
+            "  if (a[7] + a[1] !== 'grgreen') return 9;"
+            "  return 0;"
+            "};"), JS_SOURCE_CONTEXT_NONE, _u(""), &check) == JsNoError);
+
+        for (int i = 0; i < 2; i++)
+        {
+            JsValueRef result = JS_INVALID_REFERENCE;
+            REQUIRE(JsRunScript(_u("check()"), JS_SOURCE_CONTEXT_NONE, _u(""), &result) == JsNoError);
+
+            int failedCheck = -1;
+            REQUIRE(JsNumberToInt(result, &failedCheck) == JsNoError);
+            CHECK(failedCheck == 0);
+
+            // Drop the strings from the first pass so the second one re-populates the table
+            REQUIRE(JsCollectGarbage(runtime) == JsNoError);
+        }
+    }
+
+    TEST_CASE("ApiTest_StringInterningTest", "[ApiTest]")
+    {
+        JsRTApiTest::RunWithAttributes(JsRTApiTest::StringInterningTest);
+    }
+
+    void SubStringOfLargeStringTest(JsRuntimeAttributes attributes, JsRuntimeHandle runtime)
+    {
+        // Slices of a large string are either copied out or refer to the parent depending on their length;
+        // both must read exactly like a string assembled one character at a time.
+        // The script returns 0, or the number of the first check that failed.
+        JsValueRef result = JS_INVALID_REFERENCE;
+        REQUIRE(JsRunScript(_u(
+            "(function () {"
+            "  var parts = [];"
+            "  for (var i = 0; i < 12000; i++) { parts.push('k' + i + '=v' + (i % 7)); }"
+            "  var big = parts.join(';');"
+            "  function manual(s, start, end) { var r = ''; for (var i = start; i < end; i++) { r += s.charAt(i); } return r; }"
+            "  var lengths = [1, 2, 31, 32, 33, 200];"
+            "  for (var l = 0; l < lengths.length; l++) {"
+            "    for (var start = 0; start < big.length - 200; start += 9973) {"
+            "      var expected = manual(big, start, start + lengths[l]);"
+            "      if (big.substring(start, start + lengths[l]) !== expected) return 1;"
+            "      if (big.slice(start, start + lengths[l]) !== expected) return 2;"
+            "      if (big.substr(start, lengths[l]) !== expected) return 3;"
+            "      if (big.substring(start, start + lengths[l]).length !== lengths[l]) return 4;"
+            "    }"
+            "  }"
+            "  var outer = big.slice(0, 1000);"
+            "  if (outer.slice(5, 15) !== manual(big, 5, 15)) return 5;"
+            "  if (outer.slice(100, 900).slice(3, 40) !== manual(big, 103, 140)) return 6;"
+            "  var fields = big.split(';');"
+            "  if (fields.length !== 12000 || fields[11999] !== 'k11999=v1') return 7;"
+            "  var re = /k(\\d+)=v(\\d)/g, m, n = 0;"
+            "  while ((m = re.exec(big)) !== null) {"
+            "    if (m[0] !== parts[n] || m[1] !== String(n) || m[2] !== String(n % 7)) return 8;"
+            "    n++;"
+            "  }"
+            "  if (n !== 12000) return 9;"
+            "  var padded = ' '.repeat(70000) + 'core' + ' '.repeat(3);"
+            "  if (padded.trim() !== 'core') return 10;"
+            "  if (big.slice(-9) !== 'k11999=v1') return 11;"
+            "  return 0;"
+            "})()"), JS_SOURCE_CONTEXT_NONE, _u(""), &result) == JsNoError);
+
+        int failedCheck = -1;
+        REQUIRE(JsNumberToInt(result, &failedCheck) == JsNoError);
+        CHECK(failedCheck == 0);
+    }
+
+    TEST_CASE("ApiTest_SubStringOfLargeStringTest", "[ApiTest]")
+    {
+        JsRTApiTest::RunWithAttributes(JsRTApiTest::SubStringOfLargeStringTest);
+    }
+
+    void SharedRegexProgramTest(JsRuntimeAttributes attributes, JsRuntimeHandle runtime)
+    {
+        // The same literal and dynamic regexes run in two contexts of one runtime must give the same results
+        // and keep their own lastIndex, including after the second context's patterns have been collected.
+        // The script returns 0, or the number of the first check that failed.
+        const char16* script = _u(
+            "(function () {"
+            "  var text = 'id=17; name=ab; id=4; name=cd; id=250';"
+            "  var ids = /id=(\\d+)/g, m, sum = 0, n = 0;"
+            "  while ((m = ids.exec(text)) !== null) { sum += +m[1]; n++; }"
+            "  if (n !== 3 || sum !== 271 || ids.lastIndex !== 0) return 1;"
+            "  var dyn = new RegExp('name=([a-z]+)', 'g');"
+            "  if (text.replace(dyn, '<$1>') !== 'id=17; <ab>; id=4; <cd>; id=250') return 2;"
+            "  if (dyn.exec(text)[1] !== 'ab' || dyn.lastIndex !== 14) return 3;"
+            "  var again = new RegExp('name=([a-z]+)', 'g');"
+            "  if (again.lastIndex !== 0 || again.exec(text)[1] !== 'ab') return 4;"
+            "  if (text.split(/;\\s*/).length !== 5) return 5;"
+            "  if (text.split(new RegExp(';\\\\s*')).join('|') !== 'id=17|name=ab|id=4|name=cd|id=250') return 6;"
+            "  var sticky = new RegExp('id=\\\\d+', 'y');"
+            "  sticky.lastIndex = 16;"
+            "  if (sticky.exec(text)[0] !== 'id=4' || sticky.lastIndex !== 20) return 7;"
+            "  try { new RegExp('(', 'g'); return 8; } catch (e) { if (!(e instanceof SyntaxError)) return 8; }"
+            "  try { new RegExp('a', 'gg'); return 9; } catch (e) { if (!(e instanceof SyntaxError)) return 9; }"
+            "  if (/ID=(\\d+)/i.exec(text)[1] !== '17') return 10;"
+            "  if (/^name/.test(text)) return 11;"
+            "  return 0;"
+            "})()");
+
+        JsContextRef mainContext = JS_INVALID_REFERENCE, secondContext = JS_INVALID_REFERENCE;
+        JsValueRef result = JS_INVALID_REFERENCE;
+        int failedCheck = -1;
+        REQUIRE(JsGetCurrentContext(&mainContext) == JsNoError);
+
+        REQUIRE(JsRunScript(script, JS_SOURCE_CONTEXT_NONE, _u(""), &result) == JsNoError);
+        REQUIRE(JsNumberToInt(result, &failedCheck) == JsNoError);
+        CHECK(failedCheck == 0);
+
+        REQUIRE(JsCreateContext(runtime, &secondContext) == JsNoError);
+        REQUIRE(JsSetCurrentContext(secondContext) == JsNoError);
+        failedCheck = -1;
+        REQUIRE(JsRunScript(script, JS_SOURCE_CONTEXT_NONE, _u(""), &result) == JsNoError);
+        REQUIRE(JsNumberToInt(result, &failedCheck) == JsNoError);
+        CHECK(failedCheck == 0);
+
+        REQUIRE(JsSetCurrentContext(mainContext) == JsNoError);
+        secondContext = JS_INVALID_REFERENCE;
+        REQUIRE(JsCollectGarbage(runtime) == JsNoError);
+        failedCheck = -1;
+        REQUIRE(JsRunScript(script, JS_SOURCE_CONTEXT_NONE, _u(""), &result) == JsNoError);
+        REQUIRE(JsNumberToInt(result, &failedCheck) == JsNoError);
+        CHECK(failedCheck == 0);
+    }
+
+    TEST_CASE("ApiTest_SharedRegexProgramTest", "[ApiTest]")
+    {
+        JsRTApiTest::RunWithAttributes(JsRTApiTest::SharedRegexProgramTest);
+    }
+
+    void RegexLoopMemoTest(JsRuntimeAttributes attributes, JsRuntimeHandle runtime)
+    {
+        // Top-level unbounded loops remember the input offsets they have failed from. A lookahead anywhere in a pattern
+        // turns that off, so the same pattern behind an always-true lookahead is matched without it; both must agree.
+        // The backtracking-heavy inputs are kept small enough that an unmemoized match still finishes quickly.
+        // The script returns 0, or a code for the first check that failed (100 + i or 200 + i for pair i).
+        JsValueRef result = JS_INVALID_REFERENCE;
+        REQUIRE(JsRunScript(_u(
+            "(function () {"
+            "  var pairs = ["
+            "    [/(a|ab)*c/, /(?=[^]|$)(a|ab)*c/, 'xabababaabacab', '[[\"abababaabac\",\"a\"],1]'],"
+            "    [/(a|ab)*?c/, /(?=[^]|$)(a|ab)*?c/, 'xabababaabacab', '[[\"abababaabac\",\"a\"],1]'],"
+            "    [/(a|ab){2,}c/, /(?=[^]|$)(a|ab){2,}c/, 'abcaabababc', '[[\"aabababc\",\"ab\"],3]'],"
+            "    [/(a|ab){2,}?b/, /(?=[^]|$)(a|ab){2,}?b/, 'abaabab', '[[\"abaab\",\"a\"],0]'],"
+            "    [/(\\w+\\s?)*$/, /(?=[^]|$)(\\w+\\s?)*$/, 'hello big world', '[[\"hello big world\",\"world\"],0]'],"
+            "    [/(\\w+\\s?)*$/, /(?=[^]|$)(\\w+\\s?)*$/, 'hello big world!', '[[\"\",null],16]'],"
+            "    [/(a+)+b/, /(?=[^]|$)(a+)+b/, 'aaaab', '[[\"aaaab\",\"aaaa\"],0]'],"
+            "    [/(x+x+)+y/, /(?=[^]|$)(x+x+)+y/, 'xxxxxxy', '[[\"xxxxxxy\",\"xxxxxx\"],0]'],"
+            "    [/(a|b|ab)*?bc/, /(?=[^]|$)(a|b|ab)*?bc/, 'abababbc', '[[\"abababbc\",\"b\"],0]'],"
+            "    [/([a-c]+|b)*d/, /(?=[^]|$)([a-c]+|b)*d/, 'abcabcbd', '[[\"abcabcbd\",\"abcabcb\"],0]'],"
+            "    [/(ab|a)*?b{1,}/, /(?=[^]|$)(ab|a)*?b{1,}/, 'aababbb', '[[\"aababbb\",\"ab\"],0]'],"
+            "    [/(a+)+b/, /(?=[^]|$)(a+)+b/, 'a'.repeat(18), '[null,null]'],"
+            "    [/(\\w+\\s?)*$/, /(?=[^]|$)(\\w+\\s?)*$/, 'word '.repeat(5) + '!', '[[\"\",null],26]']"
+            "  ];"
+            "  for (var i = 0; i < pairs.length; i++) {"
+            "    var m = pairs[i][0].exec(pairs[i][2]), p = pairs[i][1].exec(pairs[i][2]);"
+            "    var memo = JSON.stringify([m, m && m.index]);"
+            "    if (memo !== JSON.stringify([p, p && p.index])) return 100 + i;"
+            "    if (memo !== pairs[i][3]) return 200 + i;"
+            "  }"
+            "  var text = 'ab aab xaaab abab abb';"
+            "  var expected = '<a> <a> x<a> <a><a> <a>b';"
+            "  if (text.replace(/(a|ab)+b/g, '<$1>') !== expected) return 1;"
+            "  if (text.replace(/(?=[^]|$)(a|ab)+b/g, '<$1>') !== expected) return 2;"
+            "  if (text.replace(/(a|ab)+?b/g, '<$1>') !== expected) return 3;"
+            "  return 0;"
+            "})()"), JS_SOURCE_CONTEXT_NONE, _u(""), &result) == JsNoError);
+
+        int failedCheck = -1;
+        REQUIRE(JsNumberToInt(result, &failedCheck) == JsNoError);
+        CHECK(failedCheck == 0);
+    }
+
+    TEST_CASE("ApiTest_RegexLoopMemoTest", "[ApiTest]")
+    {
+        JsRTApiTest::RunWithAttributes(JsRTApiTest::RegexLoopMemoTest);
+    }
+
+    void StringLiteralSearchTest(JsRuntimeAttributes attributes, JsRuntimeHandle runtime)
+    {
+        // Short needles placed at every offset around the vector block size must be found by indexOf, includes,
+        // split, replace and literal regexes exactly where a character-by-character search finds them.
+        // The script returns 0, or check * 10000 + needle * 100 + position for the first check that failed.
+        JsValueRef result = JS_INVALID_REFERENCE;
+        REQUIRE(JsRunScript(_u(
+            "(function () {"
+            "  function naiveIndexOf(s, t, from) {"
+            "    for (var i = from; i + t.length <= s.length; i++) { if (s.substr(i, t.length) === t) return i; }"
+            "    return -1;"
+            "  }"
+            "  var needles = ['q', 'qz', 'qzq', 'q\u0100z', 'abcdefghijklmnop', 'aq'];"
+            "  for (var n = 0; n < needles.length; n++) {"
+            "    var t = needles[n], code = n * 100;"
+            "    for (var pos = 0; pos < 40; pos++) {"
+            "      var s = 'a'.repeat(pos) + t + 'a'.repeat(40 - pos);"
+            "      for (var from = 0; from <= pos + 1; from++) {"
+            "        if (s.indexOf(t, from) !== naiveIndexOf(s, t, from)) return 10000 + code + pos;"
+            "      }"
+            "      if (!s.includes(t)) return 20000 + code + pos;"
+            "      if (s.split(t).length !== 2) return 30000 + code + pos;"
+            "      if (s.replace(t, '').length !== 40) return 40000 + code + pos;"
+            "      if (new RegExp(t.replace(/[\\^$.*+?()[\\]{}|]/g, '\\\\$&')).exec(s).index !== naiveIndexOf(s, t, 0)) return 50000 + code + pos;"
+            "    }"
+            "  }"
+            "  if ('aaaa'.indexOf('aab') !== -1) return 1;"
+            "  if ('ab'.indexOf('abc') !== -1) return 2;"
+            "  return 0;"
+            "})()"), JS_SOURCE_CONTEXT_NONE, _u(""), &result) == JsNoError);
+
+        int failedCheck = -1;
+        REQUIRE(JsNumberToInt(result, &failedCheck) == JsNoError);
+        CHECK(failedCheck == 0);
+    }
+
+    TEST_CASE("ApiTest_StringLiteralSearchTest", "[ApiTest]")
+    {
+        JsRTApiTest::RunWithAttributes(JsRTApiTest::StringLiteralSearchTest);
+    }
+
     void ApiTest_JsSerializeArrayTest(JsRuntimeAttributes /*attributes*/, JsRuntimeHandle /*runtime*/)
     {
         LPCSTR raw_script = "(function (){return true;})();";
@@ -2778,6 +3348,144 @@ namespace JsRTApiTest
         JsRTApiTest::RunWithAttributes(JsRTApiTest::ApiTest_JsSerializeParseErrorTest);
     }
 
+    static JsValueRef CopyArrayBuffer(const BYTE *data, unsigned int length)
+    {
+        JsValueRef copy = JS_INVALID_REFERENCE;
+        BYTE *copyData = nullptr;
+        unsigned int copyLength = 0;
+        REQUIRE(JsCreateArrayBuffer(length, &copy) == JsNoError);
+        REQUIRE(JsGetArrayBufferStorage(copy, &copyData, &copyLength) == JsNoError);
+        if (length > 0)
+        {
+            memcpy(copyData, data, length);
+        }
+        return copy;
+    }
+
+    void ApiTest_CompressSerializedBufferTest(JsRuntimeAttributes /*attributes*/, JsRuntimeHandle /*runtime*/)
+    {
+        // Many similar functions give a parser state with enough repetition to compress
+        std::string source;
+        for (int i = 0; i < 40; i++)
+        {
+            source += "function f" + std::to_string(i) + "(a, b) { var c = a + b; return c * " + std::to_string(i) + "; }\n";
+        }
+        source += "f6(3, 4);";
+
+        JsValueRef script = JS_INVALID_REFERENCE;
+        REQUIRE(JsCreateString(source.c_str(), source.length(), &script) == JsNoError);
+
+        JsValueRef parserState = JS_INVALID_REFERENCE;
+        REQUIRE(JsSerializeParserState(script, &parserState, JsParseScriptAttributeNone) == JsNoError);
+        BYTE *parserStateData = nullptr;
+        unsigned int parserStateLength = 0;
+        REQUIRE(JsGetArrayBufferStorage(parserState, &parserStateData, &parserStateLength) == JsNoError);
+
+        JsValueRef compressed = JS_INVALID_REFERENCE;
+        REQUIRE(JsCompressSerializedBuffer(parserState, &compressed) == JsNoError);
+        BYTE *compressedData = nullptr;
+        unsigned int compressedLength = 0;
+        REQUIRE(JsGetArrayBufferStorage(compressed, &compressedData, &compressedLength) == JsNoError);
+        CHECK(compressedLength < parserStateLength);
+
+        // The decompressed state is identical and can be used in place of the original
+        JsValueRef decompressed = JS_INVALID_REFERENCE;
+        REQUIRE(JsDecompressSerializedBuffer(compressed, &decompressed) == JsNoError);
+        BYTE *decompressedData = nullptr;
+        unsigned int decompressedLength = 0;
+        REQUIRE(JsGetArrayBufferStorage(decompressed, &decompressedData, &decompressedLength) == JsNoError);
+        REQUIRE(decompressedLength == parserStateLength);
+        CHECK(memcmp(decompressedData, parserStateData, parserStateLength) == 0);
+
+        JsValueRef sourceUrl = JS_INVALID_REFERENCE;
+        REQUIRE(JsCreateString("", 0, &sourceUrl) == JsNoError);
+        JsValueRef result = JS_INVALID_REFERENCE;
+        REQUIRE(JsRunScriptWithParserState(script, JS_SOURCE_CONTEXT_NONE, sourceUrl, JsParseScriptAttributeNone, decompressed, &result) == JsNoError);
+        int intValue = 0;
+        REQUIRE(JsNumberToInt(result, &intValue) == JsNoError);
+        CHECK(intValue == 42);
+
+        // Truncated and corrupted buffers are rejected without producing a result
+        for (unsigned int length = 0; length < compressedLength; length += (length < 16 ? 1 : 7))
+        {
+            JsValueRef truncated = CopyArrayBuffer(compressedData, length);
+            decompressed = JS_INVALID_REFERENCE;
+            CHECK(JsDecompressSerializedBuffer(truncated, &decompressed) == JsErrorInvalidArgument);
+            CHECK(decompressed == JS_INVALID_REFERENCE);
+        }
+
+        for (unsigned int offset = 0; offset < compressedLength; offset += (offset < 16 ? 1 : 5))
+        {
+            JsValueRef corrupted = CopyArrayBuffer(compressedData, compressedLength);
+            BYTE *corruptedData = nullptr;
+            unsigned int corruptedLength = 0;
+            REQUIRE(JsGetArrayBufferStorage(corrupted, &corruptedData, &corruptedLength) == JsNoError);
+            corruptedData[offset] ^= 0x5a;
+            decompressed = JS_INVALID_REFERENCE;
+            CHECK(JsDecompressSerializedBuffer(corrupted, &decompressed) == JsErrorInvalidArgument);
+            CHECK(decompressed == JS_INVALID_REFERENCE);
+        }
+
+        CHECK(JsCompressSerializedBuffer(script, &compressed) == JsErrorInvalidArgument);
+        CHECK(JsDecompressSerializedBuffer(script, &decompressed) == JsErrorInvalidArgument);
+    }
+
+    TEST_CASE("ApiTest_CompressSerializedBuffer", "[ApiTest]")
+    {
+        JsRTApiTest::RunWithAttributes(JsRTApiTest::ApiTest_CompressSerializedBufferTest);
+    }
+
+    static LPCSTR readOnlySerializedScript = "function outer(a) { function inner(b) { return a + b; } return inner(1); } outer(41);";
+
+    void ApiTest_JsRunSerializedReadOnlyTest(JsRuntimeAttributes /*attributes*/, JsRuntimeHandle /*runtime*/)
+    {
+        JsValueRef script = JS_INVALID_REFERENCE;
+        REQUIRE(JsCreateString(readOnlySerializedScript, strlen(readOnlySerializedScript), &script) == JsNoError);
+
+        JsValueRef buffer = JS_INVALID_REFERENCE;
+        REQUIRE(JsSerialize(script, &buffer, JsParseScriptAttributeNone) == JsNoError);
+
+        BYTE *bcBuffer = nullptr;
+        unsigned int bcBufferSize = 0;
+        REQUIRE(JsGetArrayBufferStorage(buffer, &bcBuffer, &bcBufferSize) == JsNoError);
+
+        // Serialized byte code is used in place, so it should run from a read-only region (e.g. a shared file mapping)
+        BYTE *readOnlyBuffer = (BYTE*)VirtualAlloc(nullptr, bcBufferSize, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+        REQUIRE(readOnlyBuffer != nullptr);
+        memcpy(readOnlyBuffer, bcBuffer, bcBufferSize);
+
+        DWORD oldProtect;
+        VirtualProtect(readOnlyBuffer, bcBufferSize, PAGE_READONLY, &oldProtect);
+        CHECK(oldProtect == PAGE_READWRITE);
+
+        JsValueRef readOnlyBufferRef = JS_INVALID_REFERENCE;
+        REQUIRE(JsCreateExternalArrayBuffer(readOnlyBuffer, bcBufferSize,
+            [](void *data)
+        {
+            VirtualFree(data, 0, MEM_RELEASE);
+        }, readOnlyBuffer, &readOnlyBufferRef) == JsNoError);
+
+        JsValueRef sourceUrl = JS_INVALID_REFERENCE;
+        REQUIRE(JsCreateString("", 0, &sourceUrl) == JsNoError);
+
+        JsValueRef result = JS_INVALID_REFERENCE;
+        REQUIRE(JsRunSerialized(readOnlyBufferRef,
+            [](JsSourceContext sourceContext, JsValueRef *value, JsParseScriptAttributes *parseAttributes)
+        {
+            *parseAttributes = JsParseScriptAttributeNone;
+            return JsCreateExternalArrayBuffer((void*)readOnlySerializedScript, (unsigned int)strlen(readOnlySerializedScript), nullptr, nullptr, value) == JsNoError;
+        }, JS_SOURCE_CONTEXT_NONE, sourceUrl, &result) == JsNoError);
+
+        int intValue = 0;
+        REQUIRE(JsNumberToInt(result, &intValue) == JsNoError);
+        CHECK(intValue == 42);
+    }
+
+    TEST_CASE("ApiTest_JsRunSerialized_ReadOnlyBuffer", "[ApiTest]")
+    {
+        JsRTApiTest::RunWithAttributes(JsRTApiTest::ApiTest_JsRunSerializedReadOnlyTest);
+    }
+
     void JsCreatePromiseTest(JsRuntimeAttributes attributes, JsRuntimeHandle runtime)
     {
         JsValueRef result = JS_INVALID_REFERENCE;
@@ -328,12 +328,12 @@ bool InterpreterThunkEmitter::NewThunkBlock()
         return false;
     }
 
-#ifdef ENABLE_OOP_NATIVE_CODEGEN
     if (CONFIG_FLAG(ForceStaticInterpreterThunk))
     {
         return false;
     }
 
+#ifdef ENABLE_OOP_NATIVE_CODEGEN
     if (JITManager::GetJITManager()->IsOOPJITEnabled())
     {
         return NewOOPJITThunkBlock();
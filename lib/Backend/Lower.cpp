@@ -8938,40 +8938,100 @@ Lowerer::LowerAddLeftDeadForString(IR::Instr *instr)
         labelHelper,
         insertBeforeInstr);
 
-    // if right->m_charLength == 1
-    InsertCompareBranch(IR::IndirOpnd::New(opndRight->AsRegOpnd(), offsetof(Js::JavascriptString, m_charLength), TyUint32, m_func),
-        IR::IntConstOpnd::New(1, TyUint32, m_func),
-        Js::OpCode::BrNeq_A, labelHelper, insertBeforeInstr);
-
     // if left->m_directCharLength == -1
     InsertCompareBranch(IR::IndirOpnd::New(opndLeft->AsRegOpnd(), (int32)Js::CompoundString::GetOffsetOfDirectCharLength(), TyUint32, m_func),
         IR::IntConstOpnd::New(UINT32_MAX, TyUint32, m_func),
         Js::OpCode::BrNeq_A, labelHelper, insertBeforeInstr);
 
-    // if lastBlockInfo.charLength < lastBlockInfo.charCapacity
     IR::IndirOpnd *indirCharLength = IR::IndirOpnd::New(opndLeft->AsRegOpnd(), (int32)Js::CompoundString::GetOffsetOfLastBlockInfo() + (int32)Js::CompoundString::GetOffsetOfLastBlockInfoCharLength(), TyUint32, m_func);
     IR::RegOpnd *charLengthOpnd = IR::RegOpnd::New(TyUint32, this->m_func);
     InsertMove(charLengthOpnd, indirCharLength, insertBeforeInstr);
-    InsertCompareBranch(charLengthOpnd, IR::IndirOpnd::New(opndLeft->AsRegOpnd(), (int32)Js::CompoundString::GetOffsetOfLastBlockInfo() + (int32)Js::CompoundString::GetOffsetOfLastBlockInfoCharCapacity(), TyUint32, m_func), Js::OpCode::BrGe_A, labelHelper, insertBeforeInstr);
-
-    // load c = right->m_pszValue[0]
-    IR::RegOpnd *pszValue0Opnd = IR::RegOpnd::New(TyMachPtr, this->m_func);
-    IR::IndirOpnd *indirRightPszOpnd = IR::IndirOpnd::New(opndRight->AsRegOpnd(), offsetof(Js::JavascriptString, m_pszValue), TyMachPtr, this->m_func);
-    InsertMove(pszValue0Opnd, indirRightPszOpnd, insertBeforeInstr);
-    IR::RegOpnd *charResultOpnd = IR::RegOpnd::New(TyUint16, this->m_func);
-    InsertMove(charResultOpnd, IR::IndirOpnd::New(pszValue0Opnd, 0, TyUint16, this->m_func), insertBeforeInstr);
 
-    // lastBlockInfo.buffer[blockCharLength] = c;
     IR::RegOpnd *baseOpnd = IR::RegOpnd::New(TyMachPtr, this->m_func);
     InsertMove(baseOpnd, IR::IndirOpnd::New(opndLeft->AsRegOpnd(), (int32)Js::CompoundString::GetOffsetOfLastBlockInfo() + (int32)Js::CompoundString::GetOffsetOfLastBlockInfoBuffer(), TyMachPtr, m_func), insertBeforeInstr);
-    IR::IndirOpnd *indirBufferToStore = IR::IndirOpnd::New(baseOpnd, charLengthOpnd, (byte)Math::Log2(sizeof(char16)), TyUint16, m_func);
-    InsertMove(indirBufferToStore, charResultOpnd, insertBeforeInstr);
 
-    // left->m_charLength++
-    InsertAdd(false, indirLeftCharLengthOpnd, regLeftCharLengthOpnd, IR::IntConstOpnd::New(1, TyUint32, this->m_func), insertBeforeInstr);
+    IR::RegOpnd *rightPszOpnd = IR::RegOpnd::New(TyMachPtr, this->m_func);
+    InsertMove(rightPszOpnd, IR::IndirOpnd::New(opndRight->AsRegOpnd(), offsetof(Js::JavascriptString, m_pszValue), TyMachPtr, this->m_func), insertBeforeInstr);
+
+    IR::RegOpnd *rightCharLengthOpnd = IR::RegOpnd::New(TyUint32, this->m_func);
+    InsertMove(rightCharLengthOpnd, IR::IndirOpnd::New(opndRight->AsRegOpnd(), offsetof(Js::JavascriptString, m_charLength), TyUint32, m_func), insertBeforeInstr);
+
+    if (PHASE_OFF(Js::StringAppendFastPathPhase, this->m_func))
+    {
+        // if right->m_charLength == 1
+        InsertCompareBranch(rightCharLengthOpnd, IR::IntConstOpnd::New(1, TyUint32, m_func), Js::OpCode::BrNeq_A, labelHelper, insertBeforeInstr);
+
+        // if lastBlockInfo.charLength < lastBlockInfo.charCapacity
+        InsertCompareBranch(charLengthOpnd, IR::IndirOpnd::New(opndLeft->AsRegOpnd(), (int32)Js::CompoundString::GetOffsetOfLastBlockInfo() + (int32)Js::CompoundString::GetOffsetOfLastBlockInfoCharCapacity(), TyUint32, m_func), Js::OpCode::BrGe_A, labelHelper, insertBeforeInstr);
+
+        // load c = right->m_pszValue[0]
+        IR::RegOpnd *charResultOpnd = IR::RegOpnd::New(TyUint16, this->m_func);
+        InsertMove(charResultOpnd, IR::IndirOpnd::New(rightPszOpnd, 0, TyUint16, this->m_func), insertBeforeInstr);
+
+        // lastBlockInfo.buffer[blockCharLength] = c;
+        IR::IndirOpnd *indirBufferToStore = IR::IndirOpnd::New(baseOpnd, charLengthOpnd, (byte)Math::Log2(sizeof(char16)), TyUint16, m_func);
+        InsertMove(indirBufferToStore, charResultOpnd, insertBeforeInstr);
+
+        // left->m_charLength++
+        InsertAdd(false, indirLeftCharLengthOpnd, regLeftCharLengthOpnd, IR::IntConstOpnd::New(1, TyUint32, this->m_func), insertBeforeInstr);
+
+        // lastBlockInfo.charLength++
+        InsertAdd(false, indirCharLength, indirCharLength, IR::IntConstOpnd::New(1, TyUint32, this->m_func), insertBeforeInstr);
+
+        InsertBranch(Js::OpCode::Br, labelFallThrough, insertBeforeInstr);
+
+        return this->LowerBinaryHelperMemWithTemp(instr, IR::HelperOp_AddLeftDead);
+    }
+
+    // Append the right string's characters directly into the last block, the same way CompoundString::AppendGeneric
+    // does for a string that is short enough to be appended as characters rather than as a pointer
+    // (see CompoundString::Block::ShouldAppendChars).
+    //
+    // if right->m_charLength - 1 < maxAppendCharLength   (unsigned, also excludes right->m_charLength == 0)
+    const uint32 maxAppendCharLength = (sizeof(void *) * 2) / sizeof(char16);
+    IR::RegOpnd *copyIndexOpnd = IR::RegOpnd::New(TyUint32, this->m_func);
+    InsertSub(false, copyIndexOpnd, rightCharLengthOpnd, IR::IntConstOpnd::New(1, TyUint32, m_func), insertBeforeInstr);
+    InsertCompareBranch(copyIndexOpnd, IR::IntConstOpnd::New(maxAppendCharLength, TyUint32, m_func), Js::OpCode::BrGe_A, true, labelHelper, insertBeforeInstr);
+
+    // if left->m_charLength + right->m_charLength <= JavascriptString::MaxCharLength
+    // (the check above only ensures room for one more character; this can't wrap since right->m_charLength <= maxAppendCharLength)
+    IR::RegOpnd *newLeftCharLengthOpnd = IR::RegOpnd::New(TyUint32, this->m_func);
+    InsertAdd(false, newLeftCharLengthOpnd, regLeftCharLengthOpnd, rightCharLengthOpnd, insertBeforeInstr);
+    InsertCompareBranch(newLeftCharLengthOpnd, IR::IntConstOpnd::New(Js::JavascriptString::MaxCharLength, TyUint32, m_func), Js::OpCode::BrGt_A, true, labelHelper, insertBeforeInstr);
+
+    // if lastBlockInfo.charLength + right->m_charLength <= lastBlockInfo.charCapacity
+    IR::RegOpnd *newCharLengthOpnd = IR::RegOpnd::New(TyUint32, this->m_func);
+    InsertAdd(false, newCharLengthOpnd, charLengthOpnd, rightCharLengthOpnd, insertBeforeInstr);
+    InsertCompareBranch(newCharLengthOpnd, IR::IndirOpnd::New(opndLeft->AsRegOpnd(), (int32)Js::CompoundString::GetOffsetOfLastBlockInfo() + (int32)Js::CompoundString::GetOffsetOfLastBlockInfoCharCapacity(), TyUint32, m_func), Js::OpCode::BrGt_A, true, labelHelper, insertBeforeInstr);
+
+    //      lea dstCharsOpnd, [lastBlockInfo.buffer + blockCharLength * sizeof(char16)]
+    // $LoopTop:
+    //      mov c, [right->m_pszValue + copyIndex * sizeof(char16)]
+    //      mov [dstCharsOpnd + copyIndex * sizeof(char16)], c
+    //      sub copyIndex, 1
+    //      cmp copyIndex, maxAppendCharLength
+    //      jb $LoopTop
+    IR::RegOpnd *dstCharsOpnd = IR::RegOpnd::New(TyMachPtr, this->m_func);
+    InsertLea(dstCharsOpnd, IR::IndirOpnd::New(baseOpnd, charLengthOpnd, (byte)Math::Log2(sizeof(char16)), TyMachPtr, m_func), insertBeforeInstr);
+
+    IR::LabelInstr *loopTop = InsertLoopTopLabel(insertBeforeInstr);
+    Loop *loop = loopTop->GetLoop();
+
+    IR::RegOpnd *charResultOpnd = IR::RegOpnd::New(TyUint16, this->m_func);
+    InsertMove(charResultOpnd, IR::IndirOpnd::New(rightPszOpnd, copyIndexOpnd, (byte)Math::Log2(sizeof(char16)), TyUint16, m_func), insertBeforeInstr);
+    InsertMove(IR::IndirOpnd::New(dstCharsOpnd, copyIndexOpnd, (byte)Math::Log2(sizeof(char16)), TyUint16, m_func), charResultOpnd, insertBeforeInstr);
+    InsertSub(false, copyIndexOpnd, copyIndexOpnd, IR::IntConstOpnd::New(1, TyUint32, m_func), insertBeforeInstr);
+    InsertCompareBranch(copyIndexOpnd, IR::IntConstOpnd::New(maxAppendCharLength, TyUint32, m_func), Js::OpCode::BrLt_A, true, loopTop, insertBeforeInstr);
+
+    loop->regAlloc.liveOnBackEdgeSyms->Set(copyIndexOpnd->m_sym->m_id);
+    loop->regAlloc.liveOnBackEdgeSyms->Set(rightPszOpnd->m_sym->m_id);
+    loop->regAlloc.liveOnBackEdgeSyms->Set(dstCharsOpnd->m_sym->m_id);
+
+    // left->m_charLength += right->m_charLength
+    InsertMove(indirLeftCharLengthOpnd, newLeftCharLengthOpnd, insertBeforeInstr);
 
-    // lastBlockInfo.charLength++
-    InsertAdd(false, indirCharLength, indirCharLength, IR::IntConstOpnd::New(1, TyUint32, this->m_func), insertBeforeInstr);
+    // lastBlockInfo.charLength = blockCharLength + right->m_charLength
+    InsertMove(indirCharLength, newCharLengthOpnd, insertBeforeInstr);
 
     InsertBranch(Js::OpCode::Br, labelFallThrough, insertBeforeInstr);
 
@@ -1816,6 +1816,8 @@ NativeCodeGenerator::PrioritizedButNotYetProcessed(JsUtil::Job *const job)
             QueuedFullJitWorkItem *const queuedFullJitWorkItem = codeGenWorkItem->GetQueuedFullJitWorkItem();
             if(queuedFullJitWorkItem)
             {
+                // Someone is waiting on it now, so it's no longer held behind the other work items
+                queuedFullJitWorkItem->SetIsQueuedBehindFullJitWorkItems(false);
                 queuedFullJitWorkItems.MoveToBeginning(queuedFullJitWorkItem);
             }
         }
@@ -1861,6 +1863,14 @@ NativeCodeGenerator::WorkItemExceedsJITLimits(CodeGenWorkItem *const codeGenWork
         (codeGenWork->GetByteCodeLength() >= (uint)CONFIG_FLAG(MaxJITFunctionBytecodeByteLength)) ||
         (codeGenWork->GetByteCodeCount() >= (uint)CONFIG_FLAG(MaxJITFunctionBytecodeCount));
 }
+
+bool
+NativeCodeGenerator::IsLargeWorkItem(CodeGenWorkItem *const codeGenWork)
+{
+    const uint largeFunctionBytecodeCount = (uint)CONFIG_FLAG(JitQueueLargeFunctionBytecodeCount);
+    return largeFunctionBytecodeCount != 0 && codeGenWork->GetByteCodeCount() >= largeFunctionBytecodeCount;
+}
+
 bool
 NativeCodeGenerator::Process(JsUtil::Job *const job, JsUtil::ParallelThreadData *threadData)
 {
@@ -1974,11 +1984,17 @@ NativeCodeGenerator::Prioritize(JsUtil::Job *const job, const bool forceAddJobTo
         // Prioritize full JIT work items over simple JIT work items. This simple solution seems sufficient for now, but it
         // might be better to use a priority queue if it becomes necessary to prioritize recent simple JIT work items relative
         // to the older simple JIT work items.
+        //
+        // A very large function can keep a JIT thread busy for a long time, so unless someone is waiting on it, don't let it
+        // jump ahead of the full JIT work items that are already waiting. Those are typically much cheaper to compile, and
+        // getting them out first reduces the overall time spent in the interpreter. It still goes ahead of simple JIT work.
+        const bool prioritize = jitMode == ExecutionMode::FullJit || queuedFullJitWorkItemCount == 0;
         AddToJitQueue(
             workItem,
-            jitMode == ExecutionMode::FullJit || queuedFullJitWorkItemCount == 0 /* prioritize */,
+            prioritize,
             false /* lock */,
-            function);
+            function,
+            prioritize && !forceAddJobToProcessor && queuedFullJitWorkItemCount != 0 && IsLargeWorkItem(workItem) /* queueBehindFullJitWorkItems */);
     }
     catch (...)
     {
@@ -2057,6 +2073,11 @@ NativeCodeGenerator::JobProcessed(JsUtil::Job *const job, const bool succeeded)
         QueuedFullJitWorkItem *const queuedFullJitWorkItem = workItem->GetQueuedFullJitWorkItem();
         if(queuedFullJitWorkItem)
         {
+            if(queuedFullJitWorkItem->IsQueuedBehindFullJitWorkItems() && PHASE_TRACE(Js::DelayPhase, workItem->GetFunctionBody()))
+            {
+                OUTPUT_TRACE(Js::DelayPhase, _u("ScriptContext: 0x%p, Processed large function queued behind full JIT work items: %-25s, Succeeded: %d \n"),
+                    this->scriptContext, workItem->GetFunctionBody()->GetExternalDisplayName(), succeeded);
+            }
             queuedFullJitWorkItems.Unlink(queuedFullJitWorkItem);
             --queuedFullJitWorkItemCount;
         }
@@ -3509,7 +3530,7 @@ NativeCodeGenerator::ProfileEnd(Js::ScriptContextProfiler *const profiler, Js::P
 
 #endif
 
-void NativeCodeGenerator::AddToJitQueue(CodeGenWorkItem *const codeGenWorkItem, bool prioritize, bool lock, void* function)
+void NativeCodeGenerator::AddToJitQueue(CodeGenWorkItem *const codeGenWorkItem, bool prioritize, bool lock, void* function, bool queueBehindFullJitWorkItems)
 {
     codeGenWorkItem->VerifyJitMode();
 
@@ -3520,27 +3541,78 @@ void NativeCodeGenerator::AddToJitQueue(CodeGenWorkItem *const codeGenWorkItem,
     scriptContext->GetThreadContext()->RegisterCodeGenRecyclableData(recyclableData);
 
     // If we have added a lot of jobs that are still waiting to be jitted, remove the oldest job
-    // to ensure we do not spend time jitting stale work items.
+    // to ensure we do not spend time jitting stale work items. Large functions that were queued behind the others are
+    // skipped, otherwise they would be the first to go on every burst of new work and might never be jitted.
     const ExecutionMode jitMode = codeGenWorkItem->GetJitMode();
     if(jitMode == ExecutionMode::FullJit &&
         queuedFullJitWorkItemCount >= (unsigned int)CONFIG_FLAG(JitQueueThreshold))
     {
-        CodeGenWorkItem *const workItemRemoved = queuedFullJitWorkItems.Tail()->WorkItem();
-        Assert(workItemRemoved->GetJitMode() == ExecutionMode::FullJit);
-        if(Processor()->RemoveJob(workItemRemoved))
+        QueuedFullJitWorkItem *queuedFullJitWorkItemToRemove = queuedFullJitWorkItems.Tail();
+        while(queuedFullJitWorkItemToRemove && queuedFullJitWorkItemToRemove->IsQueuedBehindFullJitWorkItems())
         {
-            queuedFullJitWorkItems.UnlinkFromEnd();
-            --queuedFullJitWorkItemCount;
-            workItemRemoved->OnRemoveFromJitQueue(this);
+            queuedFullJitWorkItemToRemove = queuedFullJitWorkItemToRemove->Previous();
+        }
+
+        if(queuedFullJitWorkItemToRemove)
+        {
+            CodeGenWorkItem *const workItemRemoved = queuedFullJitWorkItemToRemove->WorkItem();
+            Assert(workItemRemoved->GetJitMode() == ExecutionMode::FullJit);
+            if(Processor()->RemoveJob(workItemRemoved))
+            {
+                queuedFullJitWorkItems.Unlink(queuedFullJitWorkItemToRemove);
+                --queuedFullJitWorkItemCount;
+                workItemRemoved->OnRemoveFromJitQueue(this);
+            }
+        }
+    }
+
+    // Put the job right behind the last full JIT job of this script context that is still waiting in the processor's queue.
+    // If all of them are already being processed, there is nothing to wait behind.
+    JsUtil::Job *previousJob = nullptr;
+    if(queueBehindFullJitWorkItems)
+    {
+        Assert(jitMode == ExecutionMode::FullJit && prioritize);
+        Processor()->ForEachJob([&](JsUtil::Job *const job)
+        {
+            if(job->Manager() == this && static_cast<CodeGenWorkItem *>(job)->GetJitMode() == ExecutionMode::FullJit)
+            {
+                previousJob = job;
+            }
+            return true;
+        });
+
+        queueBehindFullJitWorkItems = previousJob != nullptr;
+        Js::FunctionBody *const functionBody = codeGenWorkItem->GetFunctionBody();
+        if(queueBehindFullJitWorkItems && PHASE_TRACE(Js::DelayPhase, functionBody))
+        {
+            OUTPUT_TRACE(Js::DelayPhase, _u("ScriptContext: 0x%p, Queued large function behind %u full JIT work items: %-25s, Byte code count: %u \n"),
+                this->scriptContext, queuedFullJitWorkItemCount, functionBody->GetExternalDisplayName(), codeGenWorkItem->GetByteCodeCount());
         }
     }
-    Processor()->AddJob(codeGenWorkItem, prioritize);   // This one can throw (really unlikely though), OOM specifically.
+
+    // These can throw (really unlikely though), OOM specifically.
+    if(queueBehindFullJitWorkItems)
+    {
+        Processor()->AddJobAfter(codeGenWorkItem, previousJob);
+    }
+    else
+    {
+        Processor()->AddJob(codeGenWorkItem, prioritize);
+    }
     if(jitMode == ExecutionMode::FullJit)
     {
+#ifdef BGJIT_STATS
+        if (codeGenWorkItem->Type() == JsFunctionType)
+        {
+            scriptContext->GetThreadContext()->RecordJitRequest(codeGenWorkItem->GetFunctionBody());
+        }
+#endif
+
         QueuedFullJitWorkItem *const queuedFullJitWorkItem = codeGenWorkItem->EnsureQueuedFullJitWorkItem();
         if(queuedFullJitWorkItem) // ignore OOM, this work item just won't be removed from the job processor's queue
         {
-            if(prioritize)
+            queuedFullJitWorkItem->SetIsQueuedBehindFullJitWorkItems(queueBehindFullJitWorkItems);
+            if(prioritize && !queueBehindFullJitWorkItems)
             {
                 queuedFullJitWorkItems.LinkToBeginning(queuedFullJitWorkItem);
             }
@@ -76,10 +76,11 @@ void SetProfileMode(BOOL fSet);
     void BeforeWaitForJob(Js::EntryPointInfo *const entryPoint) const;
     void AfterWaitForJob(Js::EntryPointInfo *const entryPoint) const;
     static bool WorkItemExceedsJITLimits(CodeGenWorkItem *const codeGenWork);
+    static bool IsLargeWorkItem(CodeGenWorkItem *const codeGenWork);
     virtual bool Process(JsUtil::Job *const job, JsUtil::ParallelThreadData *threadData) override;
     virtual void JobProcessed(JsUtil::Job *const job, const bool succeeded) override;
     JsUtil::Job *GetJobToProcessProactively();
-    void AddToJitQueue(CodeGenWorkItem *const codeGenWorkItem, bool prioritize, bool lock, void* function = nullptr);
+    void AddToJitQueue(CodeGenWorkItem *const codeGenWorkItem, bool prioritize, bool lock, void* function = nullptr, bool queueBehindFullJitWorkItems = false);
     void RemoveProactiveJobs();
     void UpdateJITState();
     static void LogCodeGenStart(CodeGenWorkItem * workItem, LARGE_INTEGER * start_time);
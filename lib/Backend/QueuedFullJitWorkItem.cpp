@@ -4,7 +4,8 @@
 //-------------------------------------------------------------------------------------------------------
 #include "Backend.h"
 
-QueuedFullJitWorkItem::QueuedFullJitWorkItem(CodeGenWorkItem *const workItem) : workItem(workItem)
+QueuedFullJitWorkItem::QueuedFullJitWorkItem(CodeGenWorkItem *const workItem)
+    : workItem(workItem), isQueuedBehindFullJitWorkItems(false)
 {
     Assert(workItem->GetJitMode() == ExecutionMode::FullJit);
 }
@@ -13,3 +14,13 @@ CodeGenWorkItem *QueuedFullJitWorkItem::WorkItem() const
 {
     return workItem;
 }
+
+bool QueuedFullJitWorkItem::IsQueuedBehindFullJitWorkItems() const
+{
+    return isQueuedBehindFullJitWorkItems;
+}
+
+void QueuedFullJitWorkItem::SetIsQueuedBehindFullJitWorkItems(const bool isQueuedBehindFullJitWorkItems)
+{
+    this->isQueuedBehindFullJitWorkItems = isQueuedBehindFullJitWorkItems;
+}
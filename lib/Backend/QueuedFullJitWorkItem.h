@@ -11,9 +11,14 @@ class QueuedFullJitWorkItem : public JsUtil::DoublyLinkedListElement<QueuedFullJ
 private:
     CodeGenWorkItem *const workItem;
 
+    // A large function that was queued behind the other full JIT work items. It isn't removed when the queue is full.
+    bool isQueuedBehindFullJitWorkItems;
+
 public:
     QueuedFullJitWorkItem(CodeGenWorkItem *const workItem);
 
 public:
     CodeGenWorkItem *WorkItem() const;
+    bool IsQueuedBehindFullJitWorkItems() const;
+    void SetIsQueuedBehindFullJitWorkItems(const bool isQueuedBehindFullJitWorkItems);
 };
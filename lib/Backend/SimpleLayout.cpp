@@ -49,6 +49,12 @@ SimpleLayout::MoveHelperBlock(IR::Instr * lastOpHelperLabel, uint32 lastOpHelper
     return instrAfter;
 }
 
+bool
+SimpleLayout::DoColdLayout() const
+{
+    return !PHASE_OFF(Js::ColdLayoutPhase, this->func);
+}
+
 void
 SimpleLayout::Layout()
 {
@@ -166,10 +172,32 @@ SimpleLayout::Layout()
                                     lastOpHelperBranchInstr->InsertAfter(branchInstr);
                                 }
                             }
+                            else if (this->DoColdLayout())
+                            {
+                                //      jmp $target         <== prevInstr           //this is unconditional jump
+                                // $helper:                 <== lastOpHelperLabel
+                                //      ...
+                                //      call helper         <== lastOpHelperInstr   //falls through
+                                // $label:                  <== labelInstr
+
+                                // The helper block is only reachable through branches, so it can go to the cold
+                                // region as well. MoveHelperBlock adds the jmp back to $label on the helper path.
 
+                                lastInstr = this->MoveHelperBlock(lastOpHelperLabel, lastOpHelperStatementIndex, lastOpHelperFunc, labelInstr, lastInstr);
+                            }
                         }
                     }
                 }
+                else if (!prevInstr->HasFallThrough() && this->DoColdLayout())
+                {
+                    //      ret / no fall through   <== prevInstr
+                    // $helper:                 <== lastOpHelperLabel
+                    //      ...
+                    //      ...                 <== lastOpHelperInstr
+                    // $label:                  <== labelInstr
+
+                    lastInstr = this->MoveHelperBlock(lastOpHelperLabel, lastOpHelperStatementIndex, lastOpHelperFunc, labelInstr, lastInstr);
+                }
                 lastOpHelperLabel = NULL;
             }
         }
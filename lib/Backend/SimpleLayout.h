@@ -11,6 +11,7 @@ class SimpleLayout
     void Layout();
 
 private:
+    bool DoColdLayout() const;
     IR::Instr * MoveHelperBlock(IR::Instr * lastOpHelperLabel, uint32 lastOpHelperStatementIndex, Func* lastOpHelperFunc, IR::LabelInstr * nextLabel,
                               IR::Instr * instrAfter);
 
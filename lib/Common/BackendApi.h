@@ -231,6 +231,7 @@ enum VTableValue {
     VtableInvalid,
     VtablePropertyString,
     VtableLazyJSONString,
+    VtableOneByteString,
     VtableLiteralStringWithPropertyStringPtr,
     VtableJavascriptBoolean,
     VtableJavascriptArray,
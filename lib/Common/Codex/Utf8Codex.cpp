@@ -4,6 +4,13 @@
 //-------------------------------------------------------------------------------------------------------
 #include "Utf8Codex.h"
 
+#if defined(_M_IX86) || defined(_M_X64)
+#define UTF8_CODEX_SIMD 1
+#include <emmintrin.h>
+#else
+#define UTF8_CODEX_SIMD 0
+#endif
+
 #ifndef _WIN32
 #undef _Analysis_assume_
 #define _Analysis_assume_(expr)
@@ -39,6 +46,25 @@ namespace utf8
         return (reinterpret_cast<size_t>(pb) & mAlignmentMask) == 0 && (reinterpret_cast<size_t>(pch) & mAlignmentMask) == 0;
     }
 
+#if UTF8_CODEX_SIMD
+    const size_t cbAsciiBlock = sizeof(__m128i);
+
+    // Skip whole 16 byte blocks that are all ASCII. Returns the start of the first block that
+    // contains a non-ASCII byte, or of the tail that is shorter than a block.
+    inline LPCUTF8 SkipAsciiBlocks(LPCUTF8 pb, LPCUTF8 pbEnd)
+    {
+        while (pb < pbEnd && (size_t)(pbEnd - pb) >= cbAsciiBlock)
+        {
+            if (_mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(pb))) != 0)
+            {
+                break;
+            }
+            pb += cbAsciiBlock;
+        }
+        return pb;
+    }
+#endif
+
     inline size_t EncodedBytes(char16 prefix)
     {
          CodexAssert(0 == (prefix & 0xFF00)); // prefix must really be a byte. We use char16 for as a convenience for the API.
@@ -350,6 +376,18 @@ namespace utf8
         if (!ShouldFastPath(p, dest)) goto LSlowPath;
 
 LFastPath:
+#if UTF8_CODEX_SIMD
+        // Widen 16 ASCII bytes at a time. Each of them decodes to exactly one unit.
+        while (p < pbEnd && (size_t)(pbEnd - p) >= cbAsciiBlock)
+        {
+            __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+            if (_mm_movemask_epi8(bytes) != 0) break;
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(dest), _mm_unpacklo_epi8(bytes, _mm_setzero_si128()));
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(dest + 8), _mm_unpackhi_epi8(bytes, _mm_setzero_si128()));
+            p += cbAsciiBlock;
+            dest += cbAsciiBlock;
+        }
+#endif
         while (p + 3 < pbEnd)
         {
             unsigned bytes = *(unsigned *)p;
@@ -429,6 +467,25 @@ namespace utf8
         if (!ShouldFastPath(dest, source)) goto LSlowPath;
 
 LFastPath:
+#if UTF8_CODEX_SIMD
+        // Narrow 16 ASCII units at a time.
+        while (cch >= cbAsciiBlock)
+        {
+            __m128i first = _mm_loadu_si128(reinterpret_cast<const __m128i *>(source));
+            __m128i second = _mm_loadu_si128(reinterpret_cast<const __m128i *>(source + 8));
+            __m128i nonAsciiBits = _mm_and_si128(_mm_or_si128(first, second), _mm_set1_epi16((short)0xFF80));
+            if (_mm_movemask_epi8(_mm_cmpeq_epi16(nonAsciiBits, _mm_setzero_si128())) != 0xFFFF) break;
+
+            if (!countBytesOnly)
+            {
+                CodexAssertOrFailFast(dest + cbAsciiBlock <= bufferEnd);
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(dest), _mm_packus_epi16(first, second));
+            }
+            dest += cbAsciiBlock;
+            source += cbAsciiBlock;
+            cch -= cbAsciiBlock;
+        }
+#endif
         while (cch >= 4)
         {
             uint32 first = ((const uint32 *)source)[0];
@@ -552,6 +609,15 @@ namespace utf8
         // Avoid using a reinterpret_cast to start a misaligned read.
         if (!IsAligned(pchCurrent)) goto LSlowPath;
 LFastPath:
+#if UTF8_CODEX_SIMD
+        if (pchCurrent < pchEnd)
+        {
+            // Every ASCII byte is one character, so skip at most i bytes.
+            LPCUTF8 pchAscii = SkipAsciiBlocks(pchCurrent, (size_t)(pchEnd - pchCurrent) > i ? pchCurrent + i : pchEnd);
+            i -= (charcount_t)(pchAscii - pchCurrent);
+            pchCurrent = pchAscii;
+        }
+#endif
         // Skip 4 bytes at a time.
         while (pchCurrent < pchEndMinus4 && i > 4)
         {
@@ -589,6 +655,13 @@ namespace utf8
         if (!IsAligned(pchCurrent)) goto LSlowPath;
 
 LFastPath:
+#if UTF8_CODEX_SIMD
+        {
+            LPCUTF8 pchAscii = SkipAsciiBlocks(pchCurrent, pchEnd);
+            i += (charcount_t)(pchAscii - pchCurrent);
+            pchCurrent = pchAscii;
+        }
+#endif
         // Skip 4 bytes at a time.
         while (pchCurrent < pchEndMinus4)
         {
@@ -616,6 +689,19 @@ namespace utf8
         return i;
     }
 
+    bool IsAsciiOnly(__in_ecount(cb) LPCUTF8 pch, size_t cb)
+    {
+        LPCUTF8 pchEnd = pch + cb;
+#if UTF8_CODEX_SIMD
+        pch = SkipAsciiBlocks(pch, pchEnd);
+#endif
+        while (pch < pchEnd)
+        {
+            if (*pch++ >= 0x80) return false;
+        }
+        return true;
+    }
+
 } // namespace utf8
 
 #ifdef _MSC_VER
@@ -469,6 +469,9 @@ namespace utf8
 
     // Convert byte index into character index
     charcount_t ByteIndexIntoCharacterIndex(__in_ecount(cbIndex) LPCUTF8 pch, size_t cbIndex, DecodeOptions options = doDefault);
+
+    // Returns true if every byte is ASCII, i.e. the cb bytes decode to exactly cb characters below 0x80.
+    bool IsAsciiOnly(__in_ecount(cb) LPCUTF8 pch, size_t cb);
 }
 
 #ifdef _MSC_VER
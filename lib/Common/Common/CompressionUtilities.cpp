@@ -5,6 +5,7 @@
 
 #include "CommonCommonPch.h"
 #include "CompressionUtilities.h"
+#include "Core/CRC.h"
 
 #ifdef ENABLE_COMPRESSION_UTILITIES
 #include <compressapi.h>
@@ -22,6 +23,315 @@ DWORD ConvertCompressionAlgorithm(CompressionUtilities::CompressionAlgorithm alg
     return static_cast<DWORD>(algorithm);
 }
 
+namespace
+{
+    // The in-tree codec writes the decompressed size (uint64) and the CRC32 of the decompressed data (uint32),
+    // followed by a stream of LZ4-style sequences.
+    // Each sequence is a token byte (high nibble literal length, low nibble match length - LzMinMatch),
+    // optional length extension bytes, the literals, and a 16-bit little-endian match offset followed by
+    // optional match length extension bytes. The final sequence only has literals.
+    const size_t LzMinMatch = 4;
+    const size_t LzLastLiterals = 5;
+    const size_t LzMatchSafeDistance = 12;
+    const size_t LzMaxOffset = 0xffff;
+    const uint LzHashLog = 14;
+    const uint LzHashTableSize = 1 << LzHashLog;
+    const uint LzRunMask = 0xf;
+    const size_t LzHeaderSize = sizeof(uint64) + sizeof(uint32);
+
+    uint LzHash(uint32 sequence)
+    {
+        return (sequence * 2654435761U) >> (32 - LzHashLog);
+    }
+
+    uint32 LzRead32(const byte* p)
+    {
+        uint32 value;
+        memcpy(&value, p, sizeof(value));
+        return value;
+    }
+
+    size_t LzCompressBound(size_t inputByteCount)
+    {
+        return LzHeaderSize + inputByteCount + inputByteCount / 255 + 16;
+    }
+
+    // Table-driven so that the checksum doesn't depend on whether the machine has the SSE4.2 CRC instruction
+    uint32 LzChecksum(const byte* p, size_t byteCount)
+    {
+        uint32 crc = (uint32)-1;
+        for (size_t i = 0; i < byteCount; i++)
+        {
+            crc = (crc >> 8) ^ crc_32_tab[(crc ^ p[i]) & 0xFF];
+        }
+        return crc ^ (uint32)-1;
+    }
+
+    byte* LzWriteLength(byte* op, size_t length)
+    {
+        while (length >= 255)
+        {
+            *op++ = 255;
+            length -= 255;
+        }
+        *op++ = (byte)length;
+        return op;
+    }
+
+    bool LzReadLength(const byte*& ip, const byte* iend, size_t* length)
+    {
+        byte b;
+        do
+        {
+            if (ip >= iend)
+            {
+                return false;
+            }
+            b = *ip++;
+            *length += b;
+        } while (b == 255);
+        return true;
+    }
+
+    byte* LzWriteSequenceHeader(byte* op, size_t literalLength, size_t matchLength)
+    {
+        byte* token = op++;
+        *token = (byte)((min(literalLength, (size_t)LzRunMask) << 4) | min(matchLength, (size_t)LzRunMask));
+        if (literalLength >= LzRunMask)
+        {
+            op = LzWriteLength(op, literalLength - LzRunMask);
+        }
+        return op;
+    }
+
+    size_t LzCompress(const byte* input, size_t inputByteCount, byte* output, uint32* hashTable)
+    {
+        const byte* const iend = input + inputByteCount;
+        const byte* ip = input;
+        const byte* anchor = input;
+        byte* op = output;
+
+        if (inputByteCount > LzMatchSafeDistance)
+        {
+            const byte* const matchLimit = iend - LzLastLiterals;
+            const byte* const ipLimit = iend - LzMatchSafeDistance;
+
+            while (ip < ipLimit)
+            {
+                const uint32 sequence = LzRead32(ip);
+                const uint hash = LzHash(sequence);
+                const byte* ref = input + hashTable[hash];
+                hashTable[hash] = (uint32)(ip - input);
+
+                if (ref >= ip || (size_t)(ip - ref) > LzMaxOffset || LzRead32(ref) != sequence)
+                {
+                    ip++;
+                    continue;
+                }
+
+                while (ip > anchor && ref > input && ip[-1] == ref[-1])
+                {
+                    ip--;
+                    ref--;
+                }
+
+                const byte* matchEnd = ip + LzMinMatch;
+                const byte* refEnd = ref + LzMinMatch;
+                while (matchEnd < matchLimit && *matchEnd == *refEnd)
+                {
+                    matchEnd++;
+                    refEnd++;
+                }
+
+                const size_t literalLength = ip - anchor;
+                const size_t matchLength = matchEnd - ip - LzMinMatch;
+                op = LzWriteSequenceHeader(op, literalLength, matchLength);
+                memcpy(op, anchor, literalLength);
+                op += literalLength;
+
+                const size_t offset = ip - ref;
+                *op++ = (byte)offset;
+                *op++ = (byte)(offset >> 8);
+                if (matchLength >= LzRunMask)
+                {
+                    op = LzWriteLength(op, matchLength - LzRunMask);
+                }
+
+                ip = matchEnd;
+                anchor = ip;
+
+                if (ip < ipLimit)
+                {
+                    hashTable[LzHash(LzRead32(ip - 2))] = (uint32)(ip - 2 - input);
+                }
+            }
+        }
+
+        const size_t literalLength = iend - anchor;
+        op = LzWriteSequenceHeader(op, literalLength, 0);
+        memcpy(op, anchor, literalLength);
+        op += literalLength;
+
+        return op - output;
+    }
+
+    bool LzDecompress(const byte* input, size_t inputByteCount, byte* output, size_t outputByteCount)
+    {
+        const byte* ip = input;
+        const byte* const iend = input + inputByteCount;
+        byte* op = output;
+        byte* const oend = output + outputByteCount;
+
+        // Every check below guards against a truncated or corrupt cache rather than trusting the stream.
+        for (;;)
+        {
+            if (ip >= iend)
+            {
+                return false;
+            }
+
+            const uint token = *ip++;
+            size_t literalLength = token >> 4;
+            if (literalLength == LzRunMask && !LzReadLength(ip, iend, &literalLength))
+            {
+                return false;
+            }
+            if ((size_t)(iend - ip) < literalLength || (size_t)(oend - op) < literalLength)
+            {
+                return false;
+            }
+            memcpy(op, ip, literalLength);
+            ip += literalLength;
+            op += literalLength;
+
+            if (ip == iend)
+            {
+                return op == oend;
+            }
+
+            if (iend - ip < 2)
+            {
+                return false;
+            }
+            const size_t offset = ip[0] | ((size_t)ip[1] << 8);
+            ip += 2;
+            if (offset == 0 || (size_t)(op - output) < offset)
+            {
+                return false;
+            }
+
+            size_t matchLength = token & LzRunMask;
+            if (matchLength == LzRunMask && !LzReadLength(ip, iend, &matchLength))
+            {
+                return false;
+            }
+            matchLength += LzMinMatch;
+            if ((size_t)(oend - op) < matchLength)
+            {
+                return false;
+            }
+
+            const byte* ref = op - offset;
+            if (offset >= matchLength)
+            {
+                memcpy(op, ref, matchLength);
+                op += matchLength;
+            }
+            else
+            {
+                // Overlapping match, e.g. a run of a repeated byte pattern
+                for (size_t i = 0; i < matchLength; i++)
+                {
+                    *op++ = *ref++;
+                }
+            }
+        }
+    }
+}
+
+HRESULT CompressionUtilities::CompressBufferLz(
+    _In_ ArenaAllocator* alloc,
+    _In_ const byte* inputBuffer,
+    _In_ size_t inputBufferByteCount,
+    _Out_ byte** compressedBuffer,
+    _Out_ size_t* compressedBufferByteCount)
+{
+    // Hash table entries are 32-bit positions, and an empty buffer is never a valid cache
+    if (inputBufferByteCount == 0 || inputBufferByteCount > UINT32_MAX)
+    {
+        return E_INVALIDARG;
+    }
+
+    uint32* hashTable = AnewNoThrowArrayZ(alloc, uint32, LzHashTableSize);
+    if (hashTable == nullptr)
+    {
+        return E_OUTOFMEMORY;
+    }
+
+    const size_t bufferByteCount = LzCompressBound(inputBufferByteCount);
+    byte* buffer = AnewNoThrowArray(alloc, byte, bufferByteCount);
+    if (buffer == nullptr)
+    {
+        AdeleteArray(alloc, LzHashTableSize, hashTable);
+        return E_OUTOFMEMORY;
+    }
+
+    const uint64 decompressedByteCount = inputBufferByteCount;
+    const uint32 checksum = LzChecksum(inputBuffer, inputBufferByteCount);
+    memcpy(buffer, &decompressedByteCount, sizeof(decompressedByteCount));
+    memcpy(buffer + sizeof(decompressedByteCount), &checksum, sizeof(checksum));
+    const size_t byteCount = LzHeaderSize + LzCompress(inputBuffer, inputBufferByteCount, buffer + LzHeaderSize, hashTable);
+    Assert(byteCount <= bufferByteCount);
+
+    AdeleteArray(alloc, LzHashTableSize, hashTable);
+
+    *compressedBuffer = buffer;
+    *compressedBufferByteCount = byteCount;
+    return S_OK;
+}
+
+HRESULT CompressionUtilities::DecompressBufferLz(
+    _In_ ArenaAllocator* alloc,
+    _In_ const byte* compressedBuffer,
+    _In_ size_t compressedBufferByteCount,
+    _Out_ byte** decompressedBuffer,
+    _Out_ size_t* decompressedBufferByteCount)
+{
+    uint64 decompressedByteCount;
+    uint32 checksum;
+    if (compressedBufferByteCount < LzHeaderSize)
+    {
+        return E_FAIL;
+    }
+    memcpy(&decompressedByteCount, compressedBuffer, sizeof(decompressedByteCount));
+    memcpy(&checksum, compressedBuffer + sizeof(decompressedByteCount), sizeof(checksum));
+
+    // Every compressed byte expands to at most 255 * 255 bytes, so anything larger is a corrupt header.
+    if (decompressedByteCount == 0 || decompressedByteCount > (uint64)compressedBufferByteCount * 255 * 255 || decompressedByteCount > SIZE_MAX)
+    {
+        return E_FAIL;
+    }
+
+    byte* buffer = AnewNoThrowArray(alloc, byte, (size_t)decompressedByteCount);
+    if (buffer == nullptr)
+    {
+        return E_OUTOFMEMORY;
+    }
+
+    // The checksum catches corruption that still decodes, e.g. a changed literal; the caller would otherwise
+    // deserialize byte code that was never validated
+    if (!LzDecompress(compressedBuffer + LzHeaderSize, compressedBufferByteCount - LzHeaderSize, buffer, (size_t)decompressedByteCount) ||
+        LzChecksum(buffer, (size_t)decompressedByteCount) != checksum)
+    {
+        AdeleteArray(alloc, (size_t)decompressedByteCount, buffer);
+        return E_FAIL;
+    }
+
+    *decompressedBuffer = buffer;
+    *decompressedBufferByteCount = (size_t)decompressedByteCount;
+    return S_OK;
+}
+
 HRESULT CompressionUtilities::CompressBuffer(
     _In_ ArenaAllocator* alloc,
     _In_ const byte* inputBuffer,
@@ -36,6 +346,11 @@ HRESULT CompressionUtilities::CompressBuffer(
     *compressedBuffer = nullptr;
     *compressedBufferByteCount = 0;
 
+    if (algorithm == CompressionAlgorithm_Lz)
+    {
+        return CompressBufferLz(alloc, inputBuffer, inputBufferByteCount, compressedBuffer, compressedBufferByteCount);
+    }
+
     HRESULT hr = E_FAIL;
 
 #ifdef ENABLE_COMPRESSION_UTILITIES
@@ -96,6 +411,11 @@ HRESULT CompressionUtilities::DecompressBuffer(
     *decompressedBuffer = nullptr;
     *decompressedBufferByteCount = 0;
 
+    if (algorithm == CompressionAlgorithm_Lz)
+    {
+        return DecompressBufferLz(alloc, compressedBuffer, compressedBufferByteCount, decompressedBuffer, decompressedBufferByteCount);
+    }
+
     HRESULT hr = E_FAIL;
 
 #ifdef ENABLE_COMPRESSION_UTILITIES
@@ -15,6 +15,15 @@ namespace Js
             CompressionAlgorithm_Xpress = 0x3,
             CompressionAlgorithm_Xpress_Huff = 0x4,
             CompressionAlgorithm_LZMS = 0x5,
+
+            // In-tree LZ77 byte codec (LZ4 block layout); available on every platform
+            CompressionAlgorithm_Lz = 0x6,
+
+#ifdef ENABLE_COMPRESSION_UTILITIES
+            CompressionAlgorithm_Default = CompressionAlgorithm_Xpress,
+#else
+            CompressionAlgorithm_Default = CompressionAlgorithm_Lz,
+#endif
             CompressionAlgorithm_Invalid = 0xf
         };
 
@@ -24,7 +33,7 @@ namespace Js
             _In_ size_t inputBufferByteCount,
             _Out_ byte** compressedBuffer,
             _Out_ size_t* compressedBufferByteCount,
-            _In_opt_ CompressionAlgorithm algorithm = CompressionAlgorithm_Xpress);
+            _In_opt_ CompressionAlgorithm algorithm = CompressionAlgorithm_Default);
 
         static HRESULT DecompressBuffer(
             _In_ ArenaAllocator* alloc,
@@ -32,6 +41,21 @@ namespace Js
             _In_ size_t compressedBufferByteCount,
             _Out_ byte** decompressedBuffer,
             _Out_ size_t* decompressedBufferByteCount,
-            _In_opt_ CompressionAlgorithm algorithm = CompressionAlgorithm_Xpress);
+            _In_opt_ CompressionAlgorithm algorithm = CompressionAlgorithm_Default);
+
+    private:
+        static HRESULT CompressBufferLz(
+            _In_ ArenaAllocator* alloc,
+            _In_ const byte* inputBuffer,
+            _In_ size_t inputBufferByteCount,
+            _Out_ byte** compressedBuffer,
+            _Out_ size_t* compressedBufferByteCount);
+
+        static HRESULT DecompressBufferLz(
+            _In_ ArenaAllocator* alloc,
+            _In_ const byte* compressedBuffer,
+            _In_ size_t compressedBufferByteCount,
+            _Out_ byte** decompressedBuffer,
+            _Out_ size_t* decompressedBufferByteCount);
     };
 }
@@ -317,6 +317,23 @@ namespace JsUtil
             jobs.LinkToEnd(job);
     }
 
+    void JobProcessor::AddJobAfter(Job *const job, Job *const previousJob)
+    {
+        // This function is called from inside the lock
+
+        Assert(job);
+        Assert(previousJob);
+        Assert(managers.Contains(job->Manager()));
+        Assert(jobs.Contains(previousJob));
+        Assert(!IsClosed());
+
+        if (job->Manager()->numJobsAddedToProcessor + 1 == 0)
+            Js::Throw::OutOfMemory();  // Overflow: job counts we use are int32's.
+        ++job->Manager()->numJobsAddedToProcessor;
+
+        jobs.LinkAfter(job, previousJob);
+    }
+
     bool JobProcessor::RemoveJob(Job *const job)
     {
         // This function is called from inside the lock
@@ -1014,6 +1031,22 @@ namespace JsUtil
         IndicateNewJob();
     }
 
+    void BackgroundJobProcessor::AddJobAfter(Job *const job, Job *const previousJob)
+    {
+        // This function is called from inside the lock
+
+        Assert(job);
+        Assert(managers.Contains(job->Manager()));
+        Assert(!IsClosed());
+
+        if(numJobs + 1 == 0)
+            Js::Throw::OutOfMemory(); // Overflow: job counts we use are int32's.
+        ++numJobs;
+
+        __super::AddJobAfter(job, previousJob);
+        IndicateNewJob();
+    }
+
     bool BackgroundJobProcessor::RemoveJob(Job *const job)
     {
         // This function is called from inside the lock
@@ -342,6 +342,9 @@ namespace JsUtil
         // manager should use JobManager::AcquireLock and JobManager::ReleaseLock for this purpose.
         virtual void AddJob(Job *const job, const bool prioritize = false);
 
+        // Add a job to the queue right behind a job that is still waiting in the queue. Must be called from inside the lock.
+        virtual void AddJobAfter(Job *const job, Job *const previousJob);
+
         // Must be called from inside the lock
         virtual bool RemoveJob(Job *const job);
 
@@ -506,6 +509,7 @@ namespace JsUtil
             const unsigned int milliseconds = INFINITE);
 
         virtual void AddJob(Job *const job, const bool prioritize = false) override;
+        virtual void AddJobAfter(Job *const job, Job *const previousJob) override;
         virtual bool RemoveJob(Job *const job) override;
 
         template<class TJobManager, class TJobHolder>
@@ -236,6 +236,7 @@ PHASE(All)
                 PHASE(ArrayCtorFastPath)
                 PHASE(NewScopeSlotFastPath)
                 PHASE(FrameDisplayFastPath)
+                PHASE(StringAppendFastPath)
                 PHASE(HoistMarkTempInit)
                 PHASE(HoistConstAddr)
             PHASE(JitWriteBarrier)
@@ -257,6 +258,7 @@ PHASE(All)
                 PHASE(ClearRegLoopExit)
         PHASE(Peeps)
         PHASE(Layout)
+            PHASE(ColdLayout)
         PHASE(EHBailoutPatchUp)
         PHASE(FinalLower)
         PHASE(PrologEpilog)
@@ -328,6 +330,8 @@ PHASE(All)
         PHASE(GeneratorGlobOpt)
         PHASE(RegexQc)
         PHASE(RegexOptBT)
+        PHASE(RegexLoopMemo)
+        PHASE(SharedRegexProgram) // Share compiled regex programs between the script contexts of a thread
         PHASE(InlineCache)
         PHASE(PolymorphicInlineCache)
         PHASE(MissingPropertyCache)
@@ -369,6 +373,8 @@ PHASE(All)
         PHASE(XDataAllocator)
         PHASE(PageAllocator)
         PHASE(StringConcat)
+        PHASE(StringInterning) // Share short runtime-created strings (JSON.parse values, split pieces) through a weak table
+        PHASE(SubStringCopyOut) // Copy short slices of very large strings instead of keeping the large buffer alive
 #if DBG_DUMP
         PHASE(PRNG)
 #endif
@@ -716,6 +722,7 @@ PHASE(All)
 #define DEFAULT_CONFIG_MaxJITFunctionBytecodeCount (120000)
 
 #define DEFAULT_CONFIG_JitQueueThreshold      (6)
+#define DEFAULT_CONFIG_JitQueueLargeFunctionBytecodeCount (20000)
 
 #define DEFAULT_CONFIG_FullJitRequeueThreshold (25)     // Minimum number of times a function needs to be executed before it is re-added to the jit queue
 
@@ -1318,6 +1325,7 @@ FLAGNR(Number,  AsmJsInlineAdjust       , "Adjustment in the maximum size in byt
 FLAGNR(String,  Interpret             , "List of functions to interpret", nullptr)
 FLAGNR(Phases,  Instrument            , "Instrument the generated code from the given phase", )
 FLAGNR(Number,  JitQueueThreshold     , "Max number of work items/script context in the jit queue", DEFAULT_CONFIG_JitQueueThreshold)
+FLAGNR(Number,  JitQueueLargeFunctionBytecodeCount, "Full JIT work items at or above this bytecode count are queued behind other full JIT work items instead of ahead of them (0 to disable)", DEFAULT_CONFIG_JitQueueLargeFunctionBytecodeCount)
 #ifdef LEAK_REPORT
 FLAGNR(String,  LeakReport            , "File name for the leak report", nullptr)
 #endif
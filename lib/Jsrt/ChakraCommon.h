@@ -482,6 +482,20 @@ typedef unsigned short uint16_t;
         //      disabled as well
         /// </summary>
         JsRuntimeAttributeDisableExecutablePageAllocation = 0x00000100,
+        /// <summary>
+        ///     Runtime will not allocate a unique interpreter thunk for each function. All interpreted
+        ///     functions are entered through a single shared entry point instead, which saves
+        ///     executable memory and an indirect jump per call. Native code generation is not affected.
+        ///     Like <c>JsRuntimeAttributeDisableExecutablePageAllocation</c>, this breaks JavaScript
+        ///     stack decoding in tools that rely on the unique thunks.
+        /// </summary>
+        JsRuntimeAttributeDisableDynamicInterpreterThunks = 0x00000200,
+        /// <summary>
+        ///     Runtime will share short strings created at runtime (such as <c>JSON.parse</c> values
+        ///     and <c>split</c> pieces) through a weak table. This saves memory for data with many
+        ///     repeated values, at the cost of a hash and a lookup for each such string.
+        /// </summary>
+        JsRuntimeAttributeEnableStringInterning = 0x00000400,
 
     } JsRuntimeAttributes;
 
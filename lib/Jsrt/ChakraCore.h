@@ -764,6 +764,11 @@ CHAKRA_API
 ///     <para>
 ///     Requires an active script context.
 ///     </para>
+///     <para>
+///     The byte code and string table are used in place and never written to, and nested
+///     functions are only deserialized when first called. An ExternalArrayBuffer over a
+///     read-only file mapping can therefore be shared by several runtimes and processes.
+///     </para>
 /// </remarks>
 /// <param name="buffer">The serialized script as an ArrayBuffer (preferably ExternalArrayBuffer).</param>
 /// <param name="scriptLoadCallback">
@@ -799,6 +804,10 @@ CHAKRA_API
 ///     The runtime will detach the data from the buffer and hold on to it until all
 ///     instances of any functions created from the buffer are garbage collected.
 ///     </para>
+///     <para>
+///     As with <c>JsParseSerialized</c>, the buffer is only read, so it may be a read-only
+///     file mapping shared with other runtimes and processes.
+///     </para>
 /// </remarks>
 /// <param name="buffer">The serialized script as an ArrayBuffer (preferably ExternalArrayBuffer).</param>
 /// <param name="scriptLoadCallback">Callback called when the source code of the script needs to be loaded.</param>
@@ -1036,6 +1045,74 @@ JsCopyStringOneByte(
     _Out_opt_ char* buffer,
     _Out_opt_ size_t* written);
 
+/// <summary>
+///     Parse Utf8 JSON text into a JavaScript value, like JSON.parse without a reviver
+/// </summary>
+/// <remarks>
+///     <para>
+///        Requires an active script context.
+///     </para>
+///     <para>
+///         The text is not turned into a JavascriptString first. It is only held
+///         in a temporary UTF-16 buffer for the duration of the parse, and the
+///         content buffer may be released as soon as the call returns.
+///     </para>
+///     <para>
+///         If the text is not valid JSON, returns JsErrorScriptException and the
+///         SyntaxError is available through JsGetAndClearException.
+///     </para>
+/// </remarks>
+/// <param name="content">Pointer to Utf8 JSON text</param>
+/// <param name="length">Number of bytes within the text, or -1 if it is null terminated</param>
+/// <param name="result">The parsed value</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+JsParseJson(
+    _In_reads_(length) const char *content,
+    _In_ size_t length,
+    _Out_ JsValueRef *result);
+
+/// <summary>
+///     Serialize a JavaScript value like JSON.stringify without a replacer or space,
+///     writing the Utf8 JSON text into a host buffer
+/// </summary>
+/// <remarks>
+///     <para>
+///        Requires an active script context.
+///     </para>
+///     <para>
+///         The text is encoded straight from the serialized value, no JavaScript string
+///         holding the UTF-16 text is created. The output is not null terminated.
+///     </para>
+///     <para>
+///         If the buffer is too small, the output is cut at a character boundary and
+///         <c>length</c> still reports the size of the whole text, so the call can be
+///         repeated with a larger buffer. Pass a null buffer to only query the size.
+///         Every call runs the serialization again, including any toJSON methods and getters.
+///     </para>
+///     <para>
+///         If the value has no JSON representation (e.g. undefined or a function),
+///         <c>length</c> is set to 0.
+///     </para>
+/// </remarks>
+/// <param name="value">The value to serialize</param>
+/// <param name="buffer">Pointer to buffer, can be null</param>
+/// <param name="bufferSize">Size of the buffer in bytes</param>
+/// <param name="written">Number of bytes written to the buffer (optional)</param>
+/// <param name="length">Number of bytes needed for the whole JSON text</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+JsStringifyToBuffer(
+    _In_ JsValueRef value,
+    _Out_writes_to_opt_(bufferSize, *written) char* buffer,
+    _In_ size_t bufferSize,
+    _Out_opt_ size_t* written,
+    _Out_ size_t* length);
+
 /// <summary>
 ///     Obtains frequently used properties of a data view.
 /// </summary>
@@ -1676,6 +1753,53 @@ CHAKRA_API
         _In_ JsValueRef parserState,
         _Out_ JsValueRef* result);
 
+/// <summary>
+///     Compresses a serialized byte code or parser state buffer so it can be stored more compactly.
+/// </summary>
+/// <remarks>
+///     <para>
+///         Requires an active script context.
+///     </para>
+///     <para>
+///         The buffer is compressed with a built-in LZ codec, so the result can be decompressed
+///         with <c>JsDecompressSerializedBuffer</c> on any platform. The input buffer is not changed.
+///     </para>
+/// </remarks>
+/// <param name="bufferVal">
+///     An ArrayBuffer produced by <c>JsSerialize</c> or <c>JsSerializeParserState</c>.
+/// </param>
+/// <param name="compressedBufferVal">A new ArrayBuffer holding the compressed data.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsCompressSerializedBuffer(
+        _In_ JsValueRef bufferVal,
+        _Out_ JsValueRef *compressedBufferVal);
+
+/// <summary>
+///     Decompresses a buffer produced by <c>JsCompressSerializedBuffer</c>.
+/// </summary>
+/// <remarks>
+///     <para>
+///         Requires an active script context.
+///     </para>
+///     <para>
+///         The result can be passed to <c>JsRunSerialized</c>, <c>JsRunScriptWithParserState</c>
+///         or <c>JsDeserializeParserState</c> like the buffer that was compressed.
+///         A truncated or corrupt buffer is rejected with <c>JsErrorInvalidArgument</c>.
+///     </para>
+/// </remarks>
+/// <param name="compressedBufferVal">An ArrayBuffer produced by <c>JsCompressSerializedBuffer</c>.</param>
+/// <param name="bufferVal">A new ArrayBuffer holding the decompressed data.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsDecompressSerializedBuffer(
+        _In_ JsValueRef compressedBufferVal,
+        _Out_ JsValueRef *bufferVal);
+
 typedef void (CHAKRA_CALLBACK *JsBeforeSweepCallback)(_In_opt_ void *callbackState);
 
 CHAKRA_API
@@ -16,6 +16,7 @@
 #include "Library/JavascriptExceptionMetadata.h"
 #include "Base/ThreadContextTlsEntry.h"
 #include "Library/JavascriptPromise.h"
+#include "Library/JSON.h"
 #include "Codex/Utf8Helper.h"
 
 CHAKRA_API
@@ -929,6 +930,69 @@ CHAKRA_API JsCreateStringUtf16(
     });
 }
 
+CHAKRA_API JsParseJson(
+    _In_reads_(length) const char *content,
+    _In_ size_t length,
+    _Out_ JsValueRef *result)
+{
+    PARAM_NOT_NULL(content);
+    PARAM_NOT_NULL(result);
+    *result = JS_INVALID_REFERENCE;
+
+    if (length == static_cast<size_t>(-1))
+    {
+        length = strlen(content);
+    }
+
+    if (length > MaxCharCount)
+    {
+        return JsErrorOutOfMemory;
+    }
+
+    return ContextAPIWrapper<JSRT_MAYBE_TRUE>([&](Js::ScriptContext *scriptContext, TTDRecorder& _actionEntryPopper) -> JsErrorCode {
+        PERFORM_JSRT_TTD_RECORD_ACTION_NOT_IMPLEMENTED(scriptContext);
+
+        // Only the parser sees the UTF-16 text, and every string it creates is a copy,
+        // so the text is released as soon as the parse is done
+        utf8::NarrowToWide wideContent(content, length);
+        if (!wideContent)
+        {
+            return JsErrorOutOfMemory;
+        }
+
+        *result = JSON::Parse(wideContent, (uint)wideContent.Length(), scriptContext);
+        return JsNoError;
+    });
+}
+
+CHAKRA_API JsStringifyToBuffer(
+    _In_ JsValueRef value,
+    _Out_writes_to_opt_(bufferSize, *written) char* buffer,
+    _In_ size_t bufferSize,
+    _Out_opt_ size_t* written,
+    _Out_ size_t* length)
+{
+    PARAM_NOT_NULL(length);
+    *length = 0;
+    if (written)
+    {
+        *written = 0;
+    }
+
+    return ContextAPIWrapper<JSRT_MAYBE_TRUE>([&](Js::ScriptContext *scriptContext, TTDRecorder& _actionEntryPopper) -> JsErrorCode {
+        PERFORM_JSRT_TTD_RECORD_ACTION_NOT_IMPLEMENTED(scriptContext);
+
+        VALIDATE_INCOMING_REFERENCE(value, scriptContext);
+
+        size_t bytesWritten = 0;
+        *length = JSON::StringifyToUtf8(value, reinterpret_cast<utf8char_t*>(buffer), buffer == nullptr ? 0 : bufferSize, &bytesWritten, scriptContext);
+        if (written)
+        {
+            *written = bytesWritten;
+        }
+        return JsNoError;
+    });
+}
 
 CHAKRA_API JsCreatePropertyString(
     _In_z_ const char *name,
@@ -11,6 +11,7 @@
 #include "JsrtSourceHolder.h"
 #include "ByteCode/ByteCodeSerializer.h"
 #include "Common/ByteSwap.h"
+#include "Common/CompressionUtilities.h"
 #include "Library/DataView.h"
 #include "Base/ThreadContextTlsEntry.h"
 #include "Codex/Utf8Helper.h"
@@ -295,6 +296,8 @@ JsErrorCode CreateRuntimeCore(_In_ JsRuntimeAttributes attributes,
             JsRuntimeAttributeDisableEval |
             JsRuntimeAttributeDisableNativeCodeGeneration |
             JsRuntimeAttributeDisableExecutablePageAllocation |
+            JsRuntimeAttributeDisableDynamicInterpreterThunks |
+            JsRuntimeAttributeEnableStringInterning |
             JsRuntimeAttributeEnableExperimentalFeatures |
             JsRuntimeAttributeDispatchSetExceptionsToDebugger |
             JsRuntimeAttributeDisableFatalOnOOM
@@ -355,11 +358,21 @@ JsErrorCode CreateRuntimeCore(_In_ JsRuntimeAttributes attributes,
             threadContext->SetThreadContextFlag(ThreadContextFlagNoDynamicThunks);
         }
 
+        if (attributes & JsRuntimeAttributeDisableDynamicInterpreterThunks)
+        {
+            threadContext->SetThreadContextFlag(ThreadContextFlagNoDynamicThunks);
+        }
+
         if (attributes & JsRuntimeAttributeDisableFatalOnOOM)
         {
             threadContext->SetThreadContextFlag(ThreadContextFlagDisableFatalOnOOM);
         }
 
+        if (attributes & JsRuntimeAttributeEnableStringInterning)
+        {
+            threadContext->SetThreadContextFlag(ThreadContextFlagStringInterning);
+        }
+
 #ifdef ENABLE_DEBUG_CONFIG_OPTIONS
         if (Js::Configuration::Global.flags.PrimeRecycler)
         {
@@ -4857,25 +4870,38 @@ CHAKRA_API JsTTDDiagSetAutoTraceStatus(_In_ bool status)
 #ifdef _CHAKRACOREBUILD
 
 
-template <class CopyFunc>
+template <class CopyFunc, class OneByteCopyFunc>
 JsErrorCode WriteStringCopy(
     JsValueRef value,
     int start,
     int length,
     _Out_opt_ size_t* written,
-    const CopyFunc& copyFunc)
+    const CopyFunc& copyFunc,
+    const OneByteCopyFunc& oneByteCopyFunc)
 {
     if (written)
     {
         *written = 0;  // init to 0 for default
     }
 
+    // Copy straight out of a one-byte string instead of widening it first
+    const byte* oneByteStr = Js::VarIs<Js::OneByteString>(value) ?
+        Js::VarTo<Js::OneByteString>(value)->GetOneByteBuffer() : nullptr;
+
     const char16* str = nullptr;
     size_t strLength = 0;
-    JsErrorCode errorCode = JsStringToPointer(value, &str, &strLength);
-    if (errorCode != JsNoError)
+    JsErrorCode errorCode = JsNoError;
+    if (oneByteStr != nullptr)
     {
-        return errorCode;
+        strLength = Js::VarTo<Js::OneByteString>(value)->GetLength();
+    }
+    else
+    {
+        errorCode = JsStringToPointer(value, &str, &strLength);
+        if (errorCode != JsNoError)
+        {
+            return errorCode;
+        }
     }
 
     if (start < 0 || (size_t)start > strLength)
@@ -4889,7 +4915,9 @@ JsErrorCode WriteStringCopy(
         return JsNoError;  // no chars written
     }
 
-    errorCode = copyFunc(str + start, count, written);
+    errorCode = oneByteStr != nullptr ?
+        oneByteCopyFunc(oneByteStr + start, count) :
+        copyFunc(str + start, count, written);
     if (errorCode != JsNoError)
     {
         return errorCode;
@@ -4921,6 +4949,17 @@ CHAKRA_API JsCopyStringUtf16(
                 memmove(buffer, src, sizeof(char16) * count);
             }
             return JsNoError;
+        },
+        [buffer](const byte* src, size_t count)
+        {
+            if (buffer)
+            {
+                for (size_t i = 0; i < count; i++)
+                {
+                    buffer[i] = src[i];
+                }
+            }
+            return JsNoError;
         });
 }
 
@@ -5239,6 +5278,14 @@ CHAKRA_API JsCopyStringOneByte(
             }
         }
         return JsNoError;
+    },
+        [buffer](const byte* src, size_t count)
+    {
+        if (buffer)
+        {
+            memmove(buffer, src, count);
+        }
+        return JsNoError;
     });
 }
 
@@ -5524,6 +5571,106 @@ CHAKRA_API JsDeserializeParserState(
     }
 }
 
+static JsErrorCode CompressionResultToErrorCode(HRESULT hr)
+{
+    if (SUCCEEDED(hr))
+    {
+        return JsNoError;
+    }
+    return hr == E_OUTOFMEMORY ? JsErrorOutOfMemory : JsErrorInvalidArgument;
+}
+
+CHAKRA_API JsCompressSerializedBuffer(
+    _In_ JsValueRef bufferVal,
+    _Out_ JsValueRef *compressedBufferVal)
+{
+    PARAM_NOT_NULL(bufferVal);
+    PARAM_NOT_NULL(compressedBufferVal);
+    VALIDATE_JSREF(bufferVal);
+    *compressedBufferVal = JS_INVALID_REFERENCE;
+
+    return ContextAPINoScriptWrapper_NoRecord([&](Js::ScriptContext *scriptContext) -> JsErrorCode {
+        if (!Js::VarIs<Js::ArrayBuffer>(bufferVal))
+        {
+            return JsErrorInvalidArgument;
+        }
+
+        Js::ArrayBuffer* arrayBuffer = Js::VarTo<Js::ArrayBuffer>(bufferVal);
+        if (arrayBuffer->GetByteLength() == 0)
+        {
+            return JsErrorInvalidArgument;
+        }
+
+        byte* compressedBuffer = nullptr;
+        size_t compressedByteCount = 0;
+        JsErrorCode errorCode = JsNoError;
+
+        // The in-tree codec is used on every platform so that a cache compressed on one platform can be
+        // decompressed on any other
+        BEGIN_TEMP_ALLOCATOR(tempAllocator, scriptContext, _u("JsCompressSerializedBuffer"));
+        errorCode = CompressionResultToErrorCode(Js::CompressionUtilities::CompressBuffer(tempAllocator, arrayBuffer->GetBuffer(),
+            arrayBuffer->GetByteLength(), &compressedBuffer, &compressedByteCount, Js::CompressionUtilities::CompressionAlgorithm_Lz));
+        if (errorCode == JsNoError)
+        {
+            if (compressedByteCount > UINT_MAX)
+            {
+                errorCode = JsErrorOutOfMemory;
+            }
+            else
+            {
+                Js::ArrayBuffer* result = scriptContext->GetLibrary()->CreateArrayBuffer((uint32)compressedByteCount);
+                js_memcpy_s(result->GetBuffer(), result->GetByteLength(), compressedBuffer, compressedByteCount);
+                *compressedBufferVal = result;
+            }
+        }
+        END_TEMP_ALLOCATOR(tempAllocator, scriptContext);
+
+        return errorCode;
+    });
+}
+
+CHAKRA_API JsDecompressSerializedBuffer(
+    _In_ JsValueRef compressedBufferVal,
+    _Out_ JsValueRef *bufferVal)
+{
+    PARAM_NOT_NULL(compressedBufferVal);
+    PARAM_NOT_NULL(bufferVal);
+    VALIDATE_JSREF(compressedBufferVal);
+    *bufferVal = JS_INVALID_REFERENCE;
+
+    return ContextAPINoScriptWrapper_NoRecord([&](Js::ScriptContext *scriptContext) -> JsErrorCode {
+        if (!Js::VarIs<Js::ArrayBuffer>(compressedBufferVal))
+        {
+            return JsErrorInvalidArgument;
+        }
+
+        Js::ArrayBuffer* arrayBuffer = Js::VarTo<Js::ArrayBuffer>(compressedBufferVal);
+        byte* decompressedBuffer = nullptr;
+        size_t decompressedByteCount = 0;
+        JsErrorCode errorCode = JsNoError;
+
+        BEGIN_TEMP_ALLOCATOR(tempAllocator, scriptContext, _u("JsDecompressSerializedBuffer"));
+        errorCode = CompressionResultToErrorCode(Js::CompressionUtilities::DecompressBuffer(tempAllocator, arrayBuffer->GetBuffer(),
+            arrayBuffer->GetByteLength(), &decompressedBuffer, &decompressedByteCount, Js::CompressionUtilities::CompressionAlgorithm_Lz));
+        if (errorCode == JsNoError)
+        {
+            if (decompressedByteCount > UINT_MAX)
+            {
+                errorCode = JsErrorOutOfMemory;
+            }
+            else
+            {
+                Js::ArrayBuffer* result = scriptContext->GetLibrary()->CreateArrayBuffer((uint32)decompressedByteCount);
+                js_memcpy_s(result->GetBuffer(), result->GetByteLength(), decompressedBuffer, decompressedByteCount);
+                *bufferVal = result;
+            }
+        }
+        END_TEMP_ALLOCATOR(tempAllocator, scriptContext);
+
+        return errorCode;
+    });
+}
+
 CHAKRA_API
 JsExecuteBackgroundParse_Experimental(
     _In_ DWORD dwBgParseCookie,
@@ -3,6 +3,7 @@
 // Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
 //-------------------------------------------------------------------------------------------------------
 #include "ParserPch.h"
+#include "Common/Event.h"
 
 #define ASSERT_THREAD() AssertMsg(mainThreadId == GetCurrentThreadContextId(), \
     "Cannot use this member of BackgroundParser from thread other than the creating context's current thread")
@@ -15,8 +16,10 @@ BackgroundParser::BackgroundParser(Js::ScriptContext *scriptContext)
         unprocessedItemsHead(nullptr),
         unprocessedItemsTail(nullptr),
         failedBackgroundParseItem(nullptr),
-        pendingBackgroundItems(0)
+        pendingBackgroundItems(0),
+        noPendingBackgroundItemsEvent(nullptr)
 {
+    this->noPendingBackgroundItemsEvent = HeapNew(Event, false /* autoReset */, true /* signaled */);
     Processor()->AddManager(this);
 
 #if DBG
@@ -40,6 +43,7 @@ BackgroundParser::~BackgroundParser()
         });
     }
     processor->RemoveManager(this);
+    HeapDelete(this->noPendingBackgroundItemsEvent);
 }
 
 BackgroundParser * BackgroundParser::New(Js::ScriptContext *scriptContext)
@@ -112,7 +116,10 @@ void BackgroundParser::JobProcessed(JsUtil::Job *const job, const bool succeeded
     // This is called from inside a lock, so we can mess with background parser attributes.
     BackgroundParseItem *backgroundItem = static_cast<BackgroundParseItem*>(job);
     this->RemoveFromUnprocessedItems(backgroundItem);
-    --this->pendingBackgroundItems;
+    if (--this->pendingBackgroundItems == 0)
+    {
+        this->noPendingBackgroundItemsEvent->Set();
+    }
     if (!succeeded)
     {
         Assert(FAILED(backgroundItem->GetHR()) || failedBackgroundParseItem);
@@ -200,12 +207,20 @@ void BackgroundParser::AfterWaitForJob(BackgroundParseItem *const item) const
 void BackgroundParser::AddToParseQueue(BackgroundParseItem *const item, bool prioritize, bool lock)
 {
     AutoOptionalCriticalSection autoLock(lock ? Processor()->GetCriticalSection() : nullptr);
-    ++this->pendingBackgroundItems;
+    if (this->pendingBackgroundItems++ == 0)
+    {
+        this->noPendingBackgroundItemsEvent->Reset();
+    }
     Processor()->AddJob(item, prioritize);   // This one can throw (really unlikely though), OOM specifically.
     this->AddUnprocessedItem(item);
     item->OnAddToParseQueue();
 }
 
+void BackgroundParser::WaitForPendingBackgroundItems() const
+{
+    this->noPendingBackgroundItemsEvent->Wait();
+}
+
 void BackgroundParser::AddUnprocessedItem(BackgroundParseItem *const item)
 {
     if (this->unprocessedItemsTail == nullptr)
@@ -5,6 +5,7 @@
 #pragma once
 
 #if ENABLE_NATIVE_CODEGEN
+class Event;
 typedef DList<ParseNode*, ArenaAllocator> NodeDList;
 
 struct BackgroundParseItem sealed : public JsUtil::Job
@@ -66,6 +67,7 @@ class BackgroundParser sealed : public JsUtil::WaitableJobManager
     static void Delete(BackgroundParser *backgroundParser);
 
     volatile uint* GetPendingBackgroundItemsPtr() const { return (volatile uint*)&pendingBackgroundItems; }
+    void WaitForPendingBackgroundItems() const;
 
     virtual bool Process(JsUtil::Job *const job, JsUtil::ParallelThreadData *threadData) override;
     virtual void JobProcessed(JsUtil::Job *const job, const bool succeeded) override;
@@ -94,6 +96,7 @@ class BackgroundParser sealed : public JsUtil::WaitableJobManager
 private:
     Js::ScriptContext *scriptContext;
     uint pendingBackgroundItems;
+    Event *noPendingBackgroundItemsEvent; // Signaled while pendingBackgroundItems is 0
     BackgroundParseItem *failedBackgroundParseItem;
     BackgroundParseItem *unprocessedItemsHead;
     BackgroundParseItem *unprocessedItemsTail;
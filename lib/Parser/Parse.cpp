@@ -579,6 +579,25 @@ HRESULT Parser::ParseSourceInternal(
     }
 #endif
 
+#if DBG_DUMP
+    if (PHASE_STATS1(Js::ParsePhase) && SUCCEEDED(hr))
+    {
+        uint usedSize = (uint)m_nodeAllocator.Size();
+        uint allocatedSize = (uint)m_nodeAllocator.AllocatedSize();
+        Output::Print(_u(" Parse arena: Used: %-10u, Allocated: %-10u %s\n"),
+            usedSize,
+            allocatedSize,
+            (grfscr & fscrDeferredFnc) ? _u("(deferred function)") : _u("(script)"));
+
+        if (!this->IsBackgroundParser())
+        {
+            m_scriptContext->parseCount++;
+            m_scriptContext->parseArenaUsedSize += usedSize;
+            m_scriptContext->parseArenaAllocatedSize += allocatedSize;
+        }
+    }
+#endif
+
     // done with the scanner
     this->GetScanner()->Clear();
 
@@ -648,8 +667,8 @@ void Parser::WaitForBackgroundJobs(BackgroundParser *bgp, CompileScriptException
         pcs->Leave();
 
         // Wait for the background threads to finish jobs they're already processing (if any).
-        // TODO: Replace with a proper semaphore.
-        while (*bgp->GetPendingBackgroundItemsPtr());
+        // Block instead of spinning so that the main thread doesn't compete with the threads it is waiting on.
+        bgp->WaitForPendingBackgroundItems();
     }
 
     Assert(!*bgp->GetPendingBackgroundItemsPtr());
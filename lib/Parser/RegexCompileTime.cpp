@@ -3927,7 +3927,10 @@ namespace UnifiedRegex
                 int maxBodyGroupId = -1;
                 body->AccumDefineGroups(compiler.scriptContext, minBodyGroupId, maxBodyGroupId);
                 Label beginLabel = compiler.CurrentLabel();
-                Label fixup = compiler.GetFixup(&EMIT(compiler, BeginLoopInst, compiler.NextLoopId(), repeats, !isNotInLoop, !body->isDeterministic, minBodyGroupId, maxBodyGroupId, isGreedy)->exitLabel);
+                // Loops which can backtrack into their own body can revisit the same input offset an exponential number of
+                // times, e.g. /(a+)+b/ or /(\w+\s?)*$/. Have them remember where they've been if that's enough to know the outcome.
+                const bool memoizeVisits = compiler.canMemoizeLoopVisits && isNotInLoop && !body->isDeterministic && repeats.IsUnbounded();
+                Label fixup = compiler.GetFixup(&EMIT(compiler, BeginLoopInst, compiler.NextLoopId(), repeats, !isNotInLoop, !body->isDeterministic, minBodyGroupId, maxBodyGroupId, isGreedy, memoizeVisits)->exitLabel);
                 body->Emit(compiler, skipped);
                 EMIT(compiler, RepeatLoopInst, beginLabel);
                 compiler.DoFixup(fixup, compiler.CurrentLabel());
@@ -4000,13 +4003,15 @@ namespace UnifiedRegex
                 int minBodyGroupId = compiler.program->numGroups;
                 int maxBodyGroupId = -1;
                 body->AccumDefineGroups(compiler.scriptContext, minBodyGroupId, maxBodyGroupId);
+                // See BeginEnd above
+                const bool memoizeVisits = compiler.canMemoizeLoopVisits && isNotInLoop && !body->isDeterministic && repeats.IsUnbounded();
                 Label beginLabel = compiler.CurrentLabel();
                 Label exitFixup;
                 if (body->firstSet->IsSingleton())
-                    exitFixup = compiler.GetFixup(&EMIT(compiler, BeginLoopIfCharInst, body->firstSet->Singleton(), compiler.NextLoopId(), repeats, !isNotInLoop, !body->isDeterministic, minBodyGroupId, maxBodyGroupId)->exitLabel);
+                    exitFixup = compiler.GetFixup(&EMIT(compiler, BeginLoopIfCharInst, body->firstSet->Singleton(), compiler.NextLoopId(), repeats, !isNotInLoop, !body->isDeterministic, minBodyGroupId, maxBodyGroupId, memoizeVisits)->exitLabel);
                 else
                 {
-                    BeginLoopIfSetInst* i = EMIT(compiler, BeginLoopIfSetInst, compiler.NextLoopId(), repeats, !isNotInLoop, !body->isDeterministic, minBodyGroupId, maxBodyGroupId);
+                    BeginLoopIfSetInst* i = EMIT(compiler, BeginLoopIfSetInst, compiler.NextLoopId(), repeats, !isNotInLoop, !body->isDeterministic, minBodyGroupId, maxBodyGroupId, memoizeVisits);
                     i->set.CloneFrom(compiler.rtAllocator, *body->firstSet);
                     exitFixup = compiler.GetFixup(&i->exitLabel);
                 }
@@ -4529,6 +4534,7 @@ namespace UnifiedRegex
         , instLen(0)
         , instNext(0)
         , nextLoopId(0)
+        , canMemoizeLoopVisits(false)
     {}
 
     void Compiler::CaptureNoLiterals(Program* program)
@@ -4569,6 +4575,50 @@ namespace UnifiedRegex
         program->numLoops = nextLoopId;
     }
 
+    void Compiler::TrySetLiteralProgramTag()
+    {
+        // SPECIAL CASE: the instructions just scan for a literal and succeed, e.g. /abc/. Keep them, but let the matcher
+        // call the scanner directly rather than going through the interpreter loop.
+        Assert(program->tag == Program::ProgramTag::InstructionsTag);
+        if (instNext == 0)
+        {
+            return;
+        }
+
+        size_t syncInstSize;
+        switch (((Inst*)instBuf)->tag)
+        {
+        case Inst::InstTag::SyncToChar2LiteralAndConsume:
+            syncInstSize = sizeof(SyncToChar2LiteralAndConsumeInst);
+            break;
+        case Inst::InstTag::SyncToLiteralAndConsume:
+            syncInstSize = sizeof(SyncToLiteralAndConsumeInst);
+            break;
+        case Inst::InstTag::SyncToLinearLiteralAndConsume:
+            syncInstSize = sizeof(SyncToLinearLiteralAndConsumeInst);
+            break;
+        case Inst::InstTag::SyncToLiteralEquivAndConsume:
+            syncInstSize = sizeof(SyncToLiteralEquivAndConsumeInst);
+            break;
+        case Inst::InstTag::SyncToLiteralEquivTrivialLastPatCharAndConsume:
+            syncInstSize = sizeof(SyncToLiteralEquivTrivialLastPatCharAndConsumeInst);
+            break;
+        default:
+            return;
+        }
+
+        // Only the overall group is set by the specialized matcher, so any other (unreachable) groups rule it out
+        if (instNext != syncInstSize + sizeof(SuccInst) ||
+            ((Inst*)(instBuf + syncInstSize))->tag != Inst::InstTag::Succ ||
+            program->numGroups != 1)
+        {
+            return;
+        }
+
+        Assert(nextLoopId == 0);
+        program->tag = Program::ProgramTag::LiteralTag;
+    }
+
     void Compiler::FreeBody()
     {
         if (instBuf != 0)
@@ -4778,10 +4828,17 @@ namespace UnifiedRegex
                         }
                     }
 
+                    compiler.canMemoizeLoopVisits =
+                        (root->features & (Node::HasMatchGroup | Node::HasAssertion)) == 0 && !PHASE_OFF1(Js::RegexLoopMemoPhase);
                     root->Emit(compiler, skipped);
 
                     compiler.Emit<SuccInst>();
                     compiler.CaptureInsts();
+
+                    if (program->tag == Program::ProgramTag::InstructionsTag)
+                    {
+                        compiler.TrySetLiteralProgramTag();
+                    }
                 }
             }
             else
@@ -610,6 +610,9 @@ namespace UnifiedRegex
         CharCount instLen;  // size of instBuf in bytes
         CharCount instNext; // offset to emit next instruction into
         int nextLoopId;
+        // True if the pattern has no backreferences or lookarounds, so what can match after a loop depends only on the
+        // input offset and the loop's iteration count (see RepeatLoopInst::Exec)
+        bool canMemoizeLoopVisits;
 
     private:
 
@@ -680,6 +683,8 @@ namespace UnifiedRegex
             this->program->tag = Program::ProgramTag::BOIInstructionsForStickyFlagTag;
         }
 
+        void TrySetLiteralProgramTag();
+
         static void CaptureNoLiterals(Program* program);
         void CaptureLiterals(Node* root, const Char *litbuf);
         static void EmitAndCaptureSuccInst(Recycler* recycler, Program* program);
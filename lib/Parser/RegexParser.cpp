@@ -2997,7 +2997,20 @@ namespace UnifiedRegex
             return nullptr;
         }
 
-        RegexPattern* pattern = RegexPattern::New(this->scriptContext, program, true);
+        // Another script context on this thread may already have compiled the same literal
+        Program* sharedProgram = RegexPattern::GetSharedProgram(this->scriptContext, program->source, program->sourceLen, flags);
+        if (sharedProgram != nullptr)
+        {
+#ifdef PROFILE_EXEC
+            this->scriptContext->ProfileEnd(Js::RegexCompilePhase);
+#endif
+            return RegexPattern::NewWithSharedProgram(this->scriptContext, sharedProgram, true);
+        }
+
+        const bool shareProgram = this->scriptContext->GetThreadContext()->CanAddSharedRegexProgram();
+        RegexPattern* pattern = shareProgram
+            ? RegexPattern::NewWithSharedProgram(this->scriptContext, program, true)
+            : RegexPattern::New(this->scriptContext, program, true);
 
 #if ENABLE_REGEX_CONFIG_OPTIONS
         RegexStats* stats = 0;
@@ -3017,7 +3030,7 @@ namespace UnifiedRegex
             this->scriptContext->GetRegexStatsDatabase()->BeginProfile();
 #endif
 
-        ArenaAllocator* rtAllocator = this->scriptContext->RegexAllocator();
+        ArenaAllocator* rtAllocator = shareProgram ? this->scriptContext->GetThreadContext()->GetSharedRegexAllocator() : this->scriptContext->RegexAllocator();
         Compiler::Compile
             ( this->scriptContext
               , ctAllocator
@@ -3038,6 +3051,11 @@ namespace UnifiedRegex
             this->scriptContext->GetRegexStatsDatabase()->EndProfile(stats, RegexStats::Compile);
 #endif
 
+        if (shareProgram)
+        {
+            pattern->AddToSharedPrograms();
+        }
+
 #ifdef PROFILE_EXEC
         this->scriptContext->ProfileEnd(Js::RegexCompilePhase);
 #endif
@@ -25,6 +25,33 @@ namespace UnifiedRegex
                 isLiteral);
     }
 
+    RegexPattern *RegexPattern::NewWithSharedProgram(Js::ScriptContext *scriptContext, Program* program, bool isLiteral)
+    {
+        // The program's body is in the thread context's shared regex allocator and isn't freed with this pattern
+        RegexPattern *result = New(scriptContext, program, isLiteral);
+        result->isShallowClone = true;
+        return result;
+    }
+
+    Program *RegexPattern::GetSharedProgram(Js::ScriptContext *scriptContext, const char16 *source, CharCount sourceLen, RegexFlags flags)
+    {
+        return scriptContext->GetThreadContext()->GetSharedRegexProgram(RegexKey(source, sourceLen, flags));
+    }
+
+    void RegexPattern::AddToSharedPrograms()
+    {
+        Assert(isShallowClone);
+
+        // Octoquad patterns register trigram state with their script context, so they aren't shared
+        if (rep.unified.trigramInfo != nullptr)
+        {
+            return;
+        }
+
+        const Program *program = rep.unified.program;
+        GetScriptContext()->GetThreadContext()->AddSharedRegexProgram(RegexKey(program->source, program->sourceLen, program->flags), rep.unified.program);
+    }
+
     void RegexPattern::Finalize(bool isShutdown)
     {
         if (isShutdown)
@@ -56,6 +83,7 @@ namespace UnifiedRegex
         }
 #endif
 
+        // Shallow clones and patterns using a thread-shared program don't own the program's body
         if (isShallowClone)
         {
             return;
@@ -50,6 +50,9 @@ namespace UnifiedRegex
         RegexPattern(Js::JavascriptLibrary *const library, Program* program, bool isLiteral);
 
         static RegexPattern *New(Js::ScriptContext *scriptContext, Program* program, bool isLiteral);
+        static RegexPattern *NewWithSharedProgram(Js::ScriptContext *scriptContext, Program* program, bool isLiteral);
+        static Program *GetSharedProgram(Js::ScriptContext *scriptContext, const char16 *source, CharCount sourceLen, RegexFlags flags);
+        void AddToSharedPrograms();
 
         virtual void Finalize(bool isShutdown) override;
         virtual void Dispose(bool isShutdown) override;
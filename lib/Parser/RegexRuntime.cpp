@@ -63,6 +63,9 @@ namespace UnifiedRegex
     const uint Matcher::TicksPerQcTimeCheck = Matcher::TicksPerQc >> 2;
     const uint Matcher::TimePerQc = AutoSystemInfo::ShouldQCMoreFrequently() ? 50 : 100; // milliseconds
 
+    // Largest number of (loop id, input offset) pairs for which RepeatLoop visits are recorded (2 MB of bits)
+    const uint64 Matcher::MaxLoopVisits = 1ull << 24;
+
 #if ENABLE_REGEX_CONFIG_OPTIONS
     void Matcher::PushStats(ContStack& contStack, const Char* const input) const
     {
@@ -555,6 +558,14 @@ namespace UnifiedRegex
             return false;
         }
 
+        if (FirstLastCharLiteralSearch::IsPreferred(2))
+        {
+#if ENABLE_REGEX_CONFIG_OPTIONS
+            matcher.CompStats();
+#endif
+            return FirstLastCharLiteralSearch::Find(input, inputLength, inputOffset, cs, 2);
+        }
+
         const uint matchC0 = Chars<char16>::CTU(cs[0]);
         const uint matchC1 = Chars<char16>::CTU(cs[1]);
 
@@ -651,6 +662,13 @@ namespace UnifiedRegex
     ScannerMixinT<ScannerT>::Match(Matcher& matcher, const char16 * const input, const CharCount inputLength, CharCount& inputOffset) const
     {
         Assert(length <= matcher.program->rep.insts.litbufLen - offset);
+        if (FirstLastCharLiteralSearch::IsPreferred(length))
+        {
+#if ENABLE_REGEX_CONFIG_OPTIONS
+            matcher.CompStats();
+#endif
+            return FirstLastCharLiteralSearch::Find(input, inputLength, inputOffset, matcher.program->rep.insts.litbuf + offset, length);
+        }
         return scanner.template Match<1>(
             input
             , inputLength
@@ -837,6 +855,13 @@ namespace UnifiedRegex
     }
 #endif
 
+#if ENABLE_REGEX_CONFIG_OPTIONS
+    void MemoizeVisitsMixin::Print(DebugWriter* w, const char16* litbuf) const
+    {
+        w->Print(_u("memoizeVisits: %s"), memoizeVisits ? _u("true") : _u("false"));
+    }
+#endif
+
 #if ENABLE_REGEX_CONFIG_OPTIONS
     void RepeatLoopMixin::Print(DebugWriter* w, const char16* litbuf) const
     {
@@ -2942,11 +2967,13 @@ namespace UnifiedRegex
         PRINT_RE_BYTECODE_BEGIN("BeginLoop");
         PRINT_MIXIN_COMMA(BeginLoopMixin);
         PRINT_MIXIN_COMMA(BodyGroupsMixin);
-        PRINT_MIXIN(GreedyMixin);
+        PRINT_MIXIN_COMMA(GreedyMixin);
+        PRINT_MIXIN(MemoizeVisitsMixin);
         PRINT_RE_BYTECODE_MID();
         PRINT_BYTES(BeginLoopMixin);
         PRINT_BYTES(BodyGroupsMixin);
         PRINT_BYTES(GreedyMixin);
+        PRINT_BYTES(MemoizeVisitsMixin);
         PRINT_RE_BYTECODE_END();
     }
 #endif
@@ -3004,6 +3031,14 @@ namespace UnifiedRegex
             // Success: proceed to remainder.
             instPointer = matcher.LabelToInstPointer(begin->exitLabel);
         }
+        else if (begin->memoizeVisits && matcher.TestAndSetLoopVisit(begin->loopId, inputLength, inputOffset))
+        {
+            // The minimum number of iterations has been satisfied and the loop is unbounded, so what can follow depends only
+            // on the input offset: the loop has no outer loops, and the pattern has no backreferences or assertions that
+            // could look at group bindings or cut continuations. We got here at this offset before in this match
+            // attempt and that did not lead to a match (otherwise we would have stopped), so FAIL without trying again.
+            return matcher.Fail(FAIL_PARAMETERS);
+        }
         else if (begin->isGreedy)
         {
             // CHOICEPOINT: Try one more iteration of body, if backtrack continue from here with no more iterations
@@ -3081,11 +3116,13 @@ namespace UnifiedRegex
         PRINT_RE_BYTECODE_BEGIN("BeginLoopIfChar");
         PRINT_MIXIN_COMMA(CharMixin);
         PRINT_MIXIN_COMMA(BeginLoopMixin);
-        PRINT_MIXIN(BodyGroupsMixin);
+        PRINT_MIXIN_COMMA(BodyGroupsMixin);
+        PRINT_MIXIN(MemoizeVisitsMixin);
         PRINT_RE_BYTECODE_MID();
         PRINT_BYTES(CharMixin);
         PRINT_BYTES(BeginLoopMixin);
         PRINT_BYTES(BodyGroupsMixin);
+        PRINT_BYTES(MemoizeVisitsMixin);
         PRINT_RE_BYTECODE_END();
     }
 #endif
@@ -3133,11 +3170,13 @@ namespace UnifiedRegex
         PRINT_RE_BYTECODE_BEGIN("BeginLoopIfSet");
         PRINT_MIXIN_COMMA(SetMixin<false>);
         PRINT_MIXIN_COMMA(BeginLoopMixin);
-        PRINT_MIXIN(BodyGroupsMixin);
+        PRINT_MIXIN_COMMA(BodyGroupsMixin);
+        PRINT_MIXIN(MemoizeVisitsMixin);
         PRINT_RE_BYTECODE_MID();
         PRINT_BYTES(SetMixin<false>);
         PRINT_BYTES(BeginLoopMixin);
         PRINT_BYTES(BodyGroupsMixin);
+        PRINT_BYTES(MemoizeVisitsMixin);
         PRINT_RE_BYTECODE_END();
     }
 #endif
@@ -3162,6 +3201,12 @@ namespace UnifiedRegex
 
         loopInfo->number++;
 
+        if (begin->memoizeVisits && loopInfo->number >= begin->repeats.lower && matcher.TestAndSetLoopVisit(begin->loopId, inputLength, inputOffset))
+        {
+            // See RepeatLoopInst::Exec
+            return matcher.Fail(FAIL_PARAMETERS);
+        }
+
 #if ENABLE_REGEX_CONFIG_OPTIONS
         matcher.CompStats();
 #endif
@@ -3232,6 +3277,12 @@ namespace UnifiedRegex
 
         loopInfo->number++;
 
+        if (begin->memoizeVisits && loopInfo->number >= begin->repeats.lower && matcher.TestAndSetLoopVisit(begin->loopId, inputLength, inputOffset))
+        {
+            // See RepeatLoopInst::Exec
+            return matcher.Fail(FAIL_PARAMETERS);
+        }
+
 #if ENABLE_REGEX_CONFIG_OPTIONS
         matcher.CompStats();
 #endif
@@ -4923,6 +4974,9 @@ namespace UnifiedRegex
         , literalNextSyncInputOffsets(nullptr)
         , recycler(scriptContext->GetRecycler())
         , previousQcTime(0)
+        , loopVisits(nullptr)
+        , loopVisitCount(0)
+        , isRecordingLoopVisits(false)
 #if ENABLE_REGEX_CONFIG_OPTIONS
         , stats(0)
         , w(0)
@@ -5150,6 +5204,69 @@ namespace UnifiedRegex
     }
 #endif
 
+    inline bool Matcher::TestAndSetLoopVisit(int loopId, const CharCount inputLength, CharCount inputOffset)
+    {
+        Assert(loopId >= 0 && loopId < program->numLoops);
+        Assert(inputOffset <= inputLength);
+
+        const uint64 numLoopVisits = (uint64)program->numLoops * ((uint64)inputLength + 1);
+        if (!isRecordingLoopVisits)
+        {
+            // Each (loop id, input offset) pair can be visited once without backtracking over it, so only start recording
+            // once there have been more visits than pairs
+            if (++loopVisitCount <= numLoopVisits || !StartRecordingLoopVisits(numLoopVisits))
+            {
+                return false;
+            }
+        }
+
+        Assert(loopVisits->Length() >= numLoopVisits);
+        return !!loopVisits->TestAndSet((BVIndex)(loopId * ((uint64)inputLength + 1) + inputOffset));
+    }
+
+    bool Matcher::StartRecordingLoopVisits(const uint64 numLoopVisits)
+    {
+        Assert(!isRecordingLoopVisits);
+
+        // Keep the bit vector to a sane size for long inputs; such matches just don't get memoized. Restart the count so
+        // that we don't retry on every visit.
+        if (numLoopVisits > MaxLoopVisits || PHASE_OFF1(Js::RegexLoopMemoPhase))
+        {
+            loopVisitCount = 0;
+            return false;
+        }
+
+        if (loopVisits == nullptr || loopVisits->Length() < numLoopVisits)
+        {
+            ArenaAllocator *const allocator = pattern->GetScriptContext()->RegexAllocator();
+            if (loopVisits != nullptr)
+            {
+                loopVisits->Delete(allocator);
+                loopVisits = nullptr;
+            }
+            loopVisits = BVFixed::New((BVIndex)numLoopVisits, allocator);
+        }
+        else
+        {
+            loopVisits->ClearAll();
+        }
+
+        isRecordingLoopVisits = true;
+
+        if (PHASE_TRACE1(Js::RegexLoopMemoPhase))
+        {
+            Output::Print(_u("Regex loop memo: /%s/ started recording loop visits after %llu visits\n"), PointerValue(program->source), (unsigned long long)loopVisitCount);
+            Output::Flush();
+        }
+        return true;
+    }
+
+    inline void Matcher::ResetLoopVisits()
+    {
+        isRecordingLoopVisits = false;
+        loopVisitCount = 0;
+    }
+
     inline bool Matcher::MatchHere(const Char* const input, const CharCount inputLength, CharCount &matchStart, CharCount &nextSyncInputOffset, ContStack &contStack, AssertionStack &assertionStack, uint &qcTicks, bool firstIteration)
     {
         // Reset the continuation and assertion stacks ready for fresh run
@@ -5166,6 +5283,7 @@ namespace UnifiedRegex
 #if DBG
         ResetLoopInfos();
 #endif
+        ResetLoopVisits();
 
         Run(input, inputLength, matchStart, nextSyncInputOffset, contStack, assertionStack, qcTicks, firstIteration);
         // Leave the continuation and assertion stack memory in place so we don't have to alloc next time
@@ -5453,6 +5571,43 @@ namespace UnifiedRegex
         return false;
     }
 
+    template <typename SyncInstT>
+    inline bool Matcher::MatchLiteral(const Char * const input, const CharCount inputLength, CharCount offset, const SyncInstT *syncInst)
+    {
+        if (syncInst->Match(*this, input, inputLength, offset))
+        {
+            GroupInfo* const info = GroupIdToGroupInfo(0);
+            info->offset = offset;
+            info->length = syncInst->GetLiteralLength();
+            return true;
+        }
+        ResetGroup(0);
+        return false;
+    }
+
+    inline bool Matcher::MatchLiteral(const Char * const input, const CharCount inputLength, CharCount offset)
+    {
+        // The program is a SyncToLiteralAndConsume instruction followed by Succ (see Compiler::TrySetLiteralProgramTag), so
+        // a scan from offset gives the same result as running the instructions at every start position
+        const Inst *inst = (const Inst *)PointerValue(program->rep.insts.insts);
+        switch (inst->tag)
+        {
+        case Inst::InstTag::SyncToChar2LiteralAndConsume:
+            return MatchLiteral(input, inputLength, offset, static_cast<const SyncToChar2LiteralAndConsumeInst *>(inst));
+        case Inst::InstTag::SyncToLiteralAndConsume:
+            return MatchLiteral(input, inputLength, offset, static_cast<const SyncToLiteralAndConsumeInst *>(inst));
+        case Inst::InstTag::SyncToLinearLiteralAndConsume:
+            return MatchLiteral(input, inputLength, offset, static_cast<const SyncToLinearLiteralAndConsumeInst *>(inst));
+        case Inst::InstTag::SyncToLiteralEquivAndConsume:
+            return MatchLiteral(input, inputLength, offset, static_cast<const SyncToLiteralEquivAndConsumeInst *>(inst));
+        case Inst::InstTag::SyncToLiteralEquivTrivialLastPatCharAndConsume:
+            return MatchLiteral(input, inputLength, offset, static_cast<const SyncToLiteralEquivTrivialLastPatCharAndConsumeInst *>(inst));
+        default:
+            Assert(false);
+            __assume(false);
+        }
+    }
+
     bool Matcher::Match
         ( const Char* const input
         , const CharCount inputLength
@@ -5547,6 +5702,10 @@ namespace UnifiedRegex
             res = MatchBOILiteral2(input, inputLength, offset, prog->rep.boiLiteral2.literal);
             break;
 
+        case Program::ProgramTag::LiteralTag:
+            res = MatchLiteral(input, inputLength, offset);
+            break;
+
         default:
             Assert(false);
             __assume(false);
@@ -5707,7 +5866,7 @@ namespace UnifiedRegex
 
     void Program::FreeBody(ArenaAllocator* rtAllocator)
     {
-        if (tag != ProgramTag::InstructionsTag || !rep.insts.insts)
+        if ((tag != ProgramTag::InstructionsTag && tag != ProgramTag::LiteralTag) || !rep.insts.insts)
         {
             return;
         }
@@ -5787,7 +5946,12 @@ namespace UnifiedRegex
         {
         case ProgramTag::BOIInstructionsTag:
         case ProgramTag::InstructionsTag:
+        case ProgramTag::LiteralTag:
             {
+                if (tag == ProgramTag::LiteralTag)
+                {
+                    w->PrintEOL(_u("special form: <match literal>"));
+                }
                 w->PrintEOL(_u("instructions: {"));
                 w->Indent();
                 if (tag == ProgramTag::BOIInstructionsTag)
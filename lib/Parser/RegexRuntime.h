@@ -74,7 +74,10 @@ namespace UnifiedRegex
             BoundedWordTag,
             LeadingTrailingSpacesTag,
             OctoquadTag,
-            BOILiteral2Tag
+            BOILiteral2Tag,
+            // Same representation as InstructionsTag, but the instructions are known to be a single literal scan followed
+            // by Succ, so the matcher calls the scanner directly instead of running the interpreter loop
+            LiteralTag
         };
 
         Field(ProgramTag) tag;
@@ -545,6 +548,19 @@ namespace UnifiedRegex
         bool isGreedy;
         inline GreedyMixin(bool isGreedy) : isGreedy(isGreedy) {}
 
+#if ENABLE_REGEX_CONFIG_OPTIONS
+        void Print(DebugWriter* w, const char16* litbuf) const;
+#endif
+    };
+
+    struct MemoizeVisitsMixin
+    {
+        // If true, a RepeatLoop(IfChar|IfSet) which has satisfied the minimum iterations records the input offset it was
+        // reached at, and fails if it reaches the same offset again during the same match attempt (see RepeatLoopInst::Exec)
+        bool memoizeVisits;
+
+        inline MemoizeVisitsMixin(bool memoizeVisits) : memoizeVisits(memoizeVisits) {}
+
 #if ENABLE_REGEX_CONFIG_OPTIONS
         void Print(DebugWriter* w, const char16* litbuf) const;
 #endif
@@ -1236,12 +1252,14 @@ namespace UnifiedRegex
     // Loops
     //
 
-    struct BeginLoopInst : Inst, BeginLoopMixin, BodyGroupsMixin, GreedyMixin
+    struct BeginLoopInst : Inst, BeginLoopMixin, BodyGroupsMixin, GreedyMixin, MemoizeVisitsMixin
     {
         // exitLabel must always be fixed up
-        inline BeginLoopInst(int loopId, const CountDomain& repeats, bool hasOuterLoops, bool hasInnerNondet, int minBodyGroupId, int maxBodyGroupId, bool isGreedy)
-            : Inst(InstTag::BeginLoop), BeginLoopMixin(loopId, repeats, hasOuterLoops, hasInnerNondet), BodyGroupsMixin(minBodyGroupId, maxBodyGroupId), GreedyMixin(isGreedy)
-        {}
+        inline BeginLoopInst(int loopId, const CountDomain& repeats, bool hasOuterLoops, bool hasInnerNondet, int minBodyGroupId, int maxBodyGroupId, bool isGreedy, bool memoizeVisits)
+            : Inst(InstTag::BeginLoop), BeginLoopMixin(loopId, repeats, hasOuterLoops, hasInnerNondet), BodyGroupsMixin(minBodyGroupId, maxBodyGroupId), GreedyMixin(isGreedy), MemoizeVisitsMixin(memoizeVisits)
+        {
+            Assert(!memoizeVisits || (!hasOuterLoops && hasInnerNondet && repeats.IsUnbounded()));
+        }
 
         INST_BODY
     };
@@ -1253,21 +1271,27 @@ namespace UnifiedRegex
         INST_BODY
     };
 
-    struct BeginLoopIfCharInst : Inst, CharMixin, BeginLoopMixin, BodyGroupsMixin
+    struct BeginLoopIfCharInst : Inst, CharMixin, BeginLoopMixin, BodyGroupsMixin, MemoizeVisitsMixin
     {
         // exitLabel must always be fixed up
-        inline BeginLoopIfCharInst(Char c, int loopId, const CountDomain& repeats, bool hasOuterLoops, bool hasInnerNondet, int minBodyGroupId, int maxBodyGroupId)
-            : Inst(InstTag::BeginLoopIfChar), CharMixin(c), BeginLoopMixin(loopId, repeats, hasOuterLoops, hasInnerNondet), BodyGroupsMixin(minBodyGroupId, maxBodyGroupId) {}
+        inline BeginLoopIfCharInst(Char c, int loopId, const CountDomain& repeats, bool hasOuterLoops, bool hasInnerNondet, int minBodyGroupId, int maxBodyGroupId, bool memoizeVisits)
+            : Inst(InstTag::BeginLoopIfChar), CharMixin(c), BeginLoopMixin(loopId, repeats, hasOuterLoops, hasInnerNondet), BodyGroupsMixin(minBodyGroupId, maxBodyGroupId), MemoizeVisitsMixin(memoizeVisits)
+        {
+            Assert(!memoizeVisits || (!hasOuterLoops && hasInnerNondet && repeats.IsUnbounded()));
+        }
 
         INST_BODY
     };
 
-    struct BeginLoopIfSetInst : Inst, SetMixin<false>, BeginLoopMixin, BodyGroupsMixin
+    struct BeginLoopIfSetInst : Inst, SetMixin<false>, BeginLoopMixin, BodyGroupsMixin, MemoizeVisitsMixin
     {
         // set must always be cloned from source
         // exitLabel must always be fixed up
-        inline BeginLoopIfSetInst(int loopId, const CountDomain& repeats, bool hasOuterLoops, bool hasInnerNondet, int minBodyGroupId, int maxBodyGroupId)
-            : Inst(InstTag::BeginLoopIfSet), BeginLoopMixin(loopId, repeats, hasOuterLoops, hasInnerNondet), BodyGroupsMixin(minBodyGroupId, maxBodyGroupId) {}
+        inline BeginLoopIfSetInst(int loopId, const CountDomain& repeats, bool hasOuterLoops, bool hasInnerNondet, int minBodyGroupId, int maxBodyGroupId, bool memoizeVisits)
+            : Inst(InstTag::BeginLoopIfSet), BeginLoopMixin(loopId, repeats, hasOuterLoops, hasInnerNondet), BodyGroupsMixin(minBodyGroupId, maxBodyGroupId), MemoizeVisitsMixin(memoizeVisits)
+        {
+            Assert(!memoizeVisits || (!hasOuterLoops && hasInnerNondet && repeats.IsUnbounded()));
+        }
 
         INST_BODY
         INST_BODY_FREE(SetMixin)
@@ -1795,6 +1819,7 @@ namespace UnifiedRegex
         static const uint TicksPerQc;
         static const uint TicksPerQcTimeCheck;
         static const uint TimePerQc; // milliseconds
+        static const uint64 MaxLoopVisits;
 
     private:
         Field(RegexPattern *) const pattern;
@@ -1822,6 +1847,13 @@ namespace UnifiedRegex
 
         Field(uint) previousQcTime;
 
+        // (loop id, input offset) pairs visited by RepeatLoop instructions of loops with memoizeVisits during the current
+        // match attempt. Recording only starts once the attempt has made more such visits than there are distinct pairs,
+        // which can only happen if it is backtracking over the same states again. In the regex allocator.
+        FieldNoBarrier(BVFixed*) loopVisits;
+        Field(uint64) loopVisitCount;
+        Field(bool) isRecordingLoopVisits;
+
 #if ENABLE_REGEX_CONFIG_OPTIONS
         FieldNoBarrier(RegexStats*) stats;
         FieldNoBarrier(DebugWriter*) w;
@@ -1887,6 +1919,11 @@ namespace UnifiedRegex
         inline void Run(const Char* const input, const CharCount inputLength, CharCount &matchStart, CharCount &nextSyncInputOffset, ContStack &contStack, AssertionStack &assertionStack, uint &qcTicks, bool firstIteration);
         inline bool MatchHere(const Char* const input, const CharCount inputLength, CharCount &matchStart, CharCount &nextSyncInputOffset, ContStack &contStack, AssertionStack &assertionStack, uint &qcTicks, bool firstIteration);
 
+        // Return true if the loop was already at inputOffset, past its minimum iterations, earlier in this match attempt
+        inline bool TestAndSetLoopVisit(int loopId, const CharCount inputLength, CharCount inputOffset);
+        bool StartRecordingLoopVisits(const uint64 numLoopVisits);
+        inline void ResetLoopVisits();
+
         // Return true if assertion succeeded
         inline bool PopAssertion(CharCount &inputOffset, const uint8 *&instPointer, ContStack &contStack, AssertionStack &assertionStack, bool isFailed);
 
@@ -1948,6 +1985,11 @@ namespace UnifiedRegex
         // Specialized matcher for regex ^literal
         inline bool MatchBOILiteral2(const Char * const input, const CharCount inputLength, CharCount offset, DWORD literal2);
 
+        // Specialized matcher for regex literal
+        inline bool MatchLiteral(const Char * const input, const CharCount inputLength, CharCount offset);
+        template <typename SyncInstT>
+        inline bool MatchLiteral(const Char * const input, const CharCount inputLength, CharCount offset, const SyncInstT *syncInst);
+
         void SaveInnerGroups(const int fromGroupId, const int toGroupId, const bool reset, const Char *const input, ContStack &contStack);
         void DoSaveInnerGroups(const int fromGroupId, const int toGroupId, const bool reset, const Char *const input, ContStack &contStack);
         void SaveInnerGroups_AllUndefined(const int fromGroupId, const int toGroupId, const Char *const input, ContStack &contStack);
@@ -4,6 +4,125 @@
 //-------------------------------------------------------------------------------------------------------
 #include "ParserPch.h"
 
+#if defined(_M_IX86) || defined(_M_X64)
+#define SCANNER_SIMD 1
+#else
+#define SCANNER_SIMD 0
+#endif
+
+#if SCANNER_SIMD
+/*****************************************************************************
+*
+*  SSE2 helpers that skip runs of ASCII characters needing no special handling
+*  in the scalar scanning loops below. Each returns the first position in
+*  [p, last) the caller has to look at. Non-ASCII units always stop the skip,
+*  so multi-unit UTF-8 characters, LS/PS and surrogates are still handled (and
+*  counted) by the existing code. A tail shorter than a vector is left to the
+*  caller.
+*/
+namespace ScannerSimd
+{
+    inline __m128i Load(const void * p) { return _mm_loadu_si128(reinterpret_cast<const __m128i *>(p)); }
+
+    inline __m128i Equal(__m128i v, char c, const utf8char_t *) { return _mm_cmpeq_epi8(v, _mm_set1_epi8(c)); }
+    inline __m128i Equal(__m128i v, char c, const char16 *) { return _mm_cmpeq_epi16(v, _mm_set1_epi16(c)); }
+
+    // Units >= 0x80
+    inline __m128i NonAscii(__m128i v, const utf8char_t *) { return _mm_cmplt_epi8(v, _mm_setzero_si128()); }
+    inline __m128i NonAscii(__m128i v, const char16 *)
+    {
+        return _mm_or_si128(_mm_cmpgt_epi16(v, _mm_set1_epi16(0x7f)), _mm_cmplt_epi16(v, _mm_setzero_si128()));
+    }
+
+    // Units < 0x20 or >= 0x80: control characters (including CR, LF and NUL) and non-ASCII
+    inline __m128i ControlOrNonAscii(__m128i v, const utf8char_t *) { return _mm_cmplt_epi8(v, _mm_set1_epi8(0x20)); }
+    inline __m128i ControlOrNonAscii(__m128i v, const char16 *)
+    {
+        return _mm_or_si128(_mm_cmpgt_epi16(v, _mm_set1_epi16(0x7f)), _mm_cmplt_epi16(v, _mm_set1_epi16(0x20)));
+    }
+
+    // Units in [lo, hi], as (unsigned)(v - lo) <= hi - lo
+    inline __m128i InRange(__m128i v, char lo, char hi)
+    {
+        const __m128i offset = _mm_sub_epi8(v, _mm_set1_epi8(lo));
+        return _mm_cmpeq_epi8(_mm_min_epu8(offset, _mm_set1_epi8(hi - lo)), offset);
+    }
+
+    template <typename EncodedChar, typename StopFn>
+    inline const EncodedChar * Skip(const EncodedChar * p, const EncodedChar * last, StopFn stop)
+    {
+        const size_t unitsPerVector = sizeof(__m128i) / sizeof(EncodedChar);
+
+        // The scanner may already be past last (it can stop at the null terminator), so check that before the
+        // unsigned distance
+        while (p < last && (size_t)(last - p) >= unitsPerVector)
+        {
+            const int mask = _mm_movemask_epi8(stop(Load(p)));
+            if (mask != 0)
+            {
+                DWORD index;
+                _BitScanForward(&index, (uint)mask);
+                return p + index / sizeof(EncodedChar);
+            }
+            p += unitsPerVector;
+        }
+        return p;
+    }
+
+    // Inside a block comment, stop at '*', CR, LF and non-ASCII.
+    template <typename EncodedChar>
+    inline const EncodedChar * SkipBlockCommentChars(const EncodedChar * p, const EncodedChar * last)
+    {
+        return Skip(p, last, [](__m128i v)
+        {
+            return _mm_or_si128(
+                _mm_or_si128(Equal(v, '*', (const EncodedChar *)nullptr), Equal(v, kchRET, (const EncodedChar *)nullptr)),
+                _mm_or_si128(Equal(v, kchNWL, (const EncodedChar *)nullptr), NonAscii(v, (const EncodedChar *)nullptr)));
+        });
+    }
+
+    // Inside a line comment, stop at CR, LF, NUL and non-ASCII.
+    template <typename EncodedChar>
+    inline const EncodedChar * SkipLineCommentChars(const EncodedChar * p, const EncodedChar * last)
+    {
+        return Skip(p, last, [](__m128i v)
+        {
+            return ControlOrNonAscii(v, (const EncodedChar *)nullptr);
+        });
+    }
+
+    // Inside a string or template literal, stop at quotes, '\\', '`', '$', control characters and non-ASCII.
+    template <typename EncodedChar>
+    inline const EncodedChar * SkipStringChars(const EncodedChar * p, const EncodedChar * last)
+    {
+        return Skip(p, last, [](__m128i v)
+        {
+            return _mm_or_si128(
+                _mm_or_si128(
+                    _mm_or_si128(Equal(v, '"', (const EncodedChar *)nullptr), Equal(v, '\'', (const EncodedChar *)nullptr)),
+                    _mm_or_si128(Equal(v, '\\', (const EncodedChar *)nullptr), Equal(v, '`', (const EncodedChar *)nullptr))),
+                _mm_or_si128(Equal(v, '$', (const EncodedChar *)nullptr), ControlOrNonAscii(v, (const EncodedChar *)nullptr)));
+        });
+    }
+
+    // ASCII identifier continue characters are [A-Za-z0-9_$]; stop at anything else (UTF-8 only).
+    inline const utf8char_t * SkipIdentifierChars(const utf8char_t * p, const utf8char_t * last)
+    {
+        return Skip(p, last, [](__m128i v)
+        {
+            const __m128i letter = InRange(_mm_or_si128(v, _mm_set1_epi8(0x20)), 'a', 'z');
+            const __m128i idContinue = _mm_or_si128(
+                _mm_or_si128(letter, InRange(v, '0', '9')),
+                _mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8('_')), _mm_cmpeq_epi8(v, _mm_set1_epi8('$'))));
+            return _mm_andnot_si128(idContinue, _mm_set1_epi8((char)0xff));
+        });
+    }
+
+    // The UTF-16 scanner doesn't take the identifier fast path.
+    inline const char16 * SkipIdentifierChars(const char16 * p, const char16 *) { return p; }
+}
+#endif
+
 /*****************************************************************************
 *
 *  The following table speeds various tests of characters, such as whether
@@ -435,6 +554,9 @@ BOOL Scanner<EncodingPolicy>::FastIdentifierContinue(EncodedCharPtr&p, EncodedCh
 {
     if (EncodingPolicy::MultiUnitEncoding)
     {
+#if SCANNER_SIMD
+        p = ScannerSimd::SkipIdentifierChars(p, last);
+#endif
         while (p < last)
         {
             EncodedChar currentChar = *p;
@@ -1051,6 +1173,16 @@ tokens Scanner<EncodingPolicy>::ScanStringConstant(OLECHAR delim, EncodedCharPtr
 
     for (;;)
     {
+#if SCANNER_SIMD
+        EncodedCharPtr pchRunEnd = ScannerSimd::SkipStringChars(p, last);
+        if (pchRunEnd != p)
+        {
+            m_tempChBuf.AppendAsciiChars(p, (charcount_t)(pchRunEnd - p));
+            m_tempChBufSecondary.template AppendAsciiChars<createRawString>(p, (charcount_t)(pchRunEnd - p));
+            p = pchRunEnd;
+        }
+#endif
+
         switch ((rawch = ch = this->ReadFirst(p, last)))
         {
         case kchRET:
@@ -1453,6 +1585,10 @@ tokens Scanner<EncodingPolicy>::SkipComment(EncodedCharPtr *pp, /* out */ bool*
 
     for (;;)
     {
+#if SCANNER_SIMD
+        p = ScannerSimd::SkipBlockCommentChars(p, last);
+#endif
+
         switch((ch = this->ReadFirst(p, last)))
         {
         case '*':
@@ -1986,6 +2122,10 @@ tokens Scanner<EncodingPolicy>::ScanCore(bool identifyKwds)
                 pchT = NULL;
                 for (;;)
                 {
+#if SCANNER_SIMD
+                    p = ScannerSimd::SkipLineCommentChars(p, last);
+#endif
+
                     switch ((ch = this->ReadFirst(p, last)))
                     {
                     case kchLS:         // 0x2028, classifies as new line
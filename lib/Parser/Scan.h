@@ -676,6 +676,34 @@ class Scanner : public IScanner, public EncodingPolicy
             }
         }
 
+        template <typename EncodedChar>
+        void AppendAsciiChars(const EncodedChar *pch, charcount_t cch)
+        {
+            return AppendAsciiChars<true>(pch, cch);
+        }
+
+        // Appends a run of ASCII characters (one code unit each in either encoding), widening UTF-8 units as needed.
+        template <bool performAppend, typename EncodedChar>
+        void AppendAsciiChars(const EncodedChar *pch, charcount_t cch)
+        {
+            if (performAppend)
+            {
+                while (cch > m_cchMax - m_ichCur)
+                {
+                    Grow();
+                }
+
+                Assert(m_ichCur + cch <= m_cchMax);
+                OLECHAR *pchDst = m_prgch + m_ichCur;
+                for (charcount_t i = 0; i < cch; i++)
+                {
+                    Assert(pch[i] < 0x80);
+                    pchDst[i] = static_cast<OLECHAR>(pch[i]);
+                }
+                m_ichCur += cch;
+            }
+        }
+
     private:
         void Grow()
         {
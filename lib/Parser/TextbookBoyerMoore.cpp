@@ -418,6 +418,72 @@ namespace UnifiedRegex
         return false;
     }
 
+    bool FirstLastCharLiteralSearch::Find
+        ( const char16 *const input
+        , const CharCount inputLength
+        , CharCount& inputOffset
+        , const char16 *const pat
+        , const CharCount patLen
+        )
+    {
+        Assert(input != nullptr);
+        Assert(patLen > 0);
+
+        if (inputOffset > inputLength || inputLength - inputOffset < patLen)
+        {
+            return false;
+        }
+
+        const char16 firstChar = pat[0];
+        const char16 lastChar = pat[patLen - 1];
+        const CharCount lastPatCharIndex = patLen - 1;
+        const size_t middleBytes = patLen > 2 ? (patLen - 2) * sizeof(char16) : 0;
+
+        const char16 * p = input + inputOffset;
+        // One past the last position a match can start at
+        const char16 * const end = input + inputLength - lastPatCharIndex;
+
+#if defined(_M_IX86) || defined(_M_X64)
+        const size_t charsPerVector = sizeof(__m128i) / sizeof(char16);
+        const __m128i firstChars = _mm_set1_epi16((short)firstChar);
+        const __m128i lastChars = _mm_set1_epi16((short)lastChar);
+
+        // The second load ends at p + charsPerVector - 1 + lastPatCharIndex, which is within the input as long
+        // as a whole vector of start positions remains
+        while ((size_t)(end - p) >= charsPerVector)
+        {
+            const __m128i firstEq = _mm_cmpeq_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i *>(p)), firstChars);
+            const __m128i lastEq = _mm_cmpeq_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i *>(p + lastPatCharIndex)), lastChars);
+            uint mask = (uint)_mm_movemask_epi8(_mm_and_si128(firstEq, lastEq));
+            while (mask != 0)
+            {
+                DWORD index;
+                _BitScanForward(&index, mask);
+                const char16 * const candidate = p + index / sizeof(char16);
+                if (middleBytes == 0 || memcmp(candidate + 1, pat + 1, middleBytes) == 0)
+                {
+                    inputOffset = (CharCount)(candidate - input);
+                    return true;
+                }
+                // Each char16 lane sets two mask bits
+                mask &= ~(3u << index);
+            }
+            p += charsPerVector;
+        }
+#endif
+
+        for (; p < end; p++)
+        {
+            if (p[0] == firstChar && p[lastPatCharIndex] == lastChar &&
+                (middleBytes == 0 || memcmp(p + 1, pat + 1, middleBytes) == 0))
+            {
+                inputOffset = (CharCount)(p - input);
+                return true;
+            }
+        }
+        return false;
+    }
+
     // explicit instantiation
     template struct TextbookBoyerMooreSetup<char16>;
     template class TextbookBoyerMoore<char16>;
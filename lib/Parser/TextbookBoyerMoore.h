@@ -159,4 +159,33 @@ namespace UnifiedRegex
         static char16 const * GetName() { return _u("full map Boyer-Moore"); }
 #endif
     };
+
+    // Exact search for short literals. A block of candidate positions is compared against the first and last
+    // pattern characters at once, and the rest of the pattern is only compared where both match. Boyer-Moore
+    // cannot shift by more than the pattern length, so for short patterns this is faster than its skip loop.
+    // Shared by the regex literal scanners and the String.prototype search functions.
+    class FirstLastCharLiteralSearch
+    {
+    public:
+        static const CharCount MaxPatternLength = 16;
+
+        // True if Find should be preferred over a Boyer-Moore scan for a pattern of this length
+        static bool IsPreferred(const CharCount patLen)
+        {
+#if defined(_M_IX86) || defined(_M_X64)
+            return patLen > 0 && patLen <= MaxPatternLength;
+#else
+            return false;
+#endif
+        }
+
+        // Find the first occurrence of pat at or after inputOffset. If found, inputOffset is set to its start.
+        static bool Find
+            ( const char16 *const input
+            , const CharCount inputLength
+            , CharCount& inputOffset
+            , const char16 *const pat
+            , const CharCount patLen
+            );
+    };
 }
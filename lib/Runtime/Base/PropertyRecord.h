@@ -196,6 +196,13 @@ namespace Js
             this->hashCode = JsUtil::CharacterBuffer<WCHAR>::StaticGetHashCode(string, len);
         }
 
+        // Use a hash that was computed earlier, e.g. one persisted in the byte code cache
+        HashedCharacterBuffer(TChar const * string, charcount_t len, hash_t hashCode) :
+            JsUtil::CharacterBuffer<TChar>(string, len), hashCode(hashCode)
+        {
+            Assert(hashCode == JsUtil::CharacterBuffer<WCHAR>::StaticGetHashCode(string, len));
+        }
+
         hash_t GetHashCode() const { return this->hashCode; }
     };
 
@@ -236,7 +236,7 @@ namespace Js
 #endif
 
 #ifdef BGJIT_STATS
-        interpretedCount = maxFuncInterpret = funcJITCount = bytecodeJITCount = interpretedCallsHighPri = jitCodeUsed = funcJitCodeUsed = loopJITCount = speculativeJitCount = 0;
+        interpretedCount = maxFuncInterpret = funcJITCount = bytecodeJITCount = interpretedCallsHighPri = jitCodeUsed = funcJitCodeUsed = loopJITCount = speculativeJitCount = repeatedFuncJITCount = repeatedBytecodeJITCount = 0;
 #endif
 
 #ifdef PROFILE_TYPES
@@ -285,6 +285,9 @@ namespace Js
         byteCodeDataSize = 0;
         byteCodeAuxiliaryDataSize = 0;
         byteCodeAuxiliaryContextDataSize = 0;
+        parseCount = 0;
+        parseArenaUsedSize = 0;
+        parseArenaAllocatedSize = 0;
         memset(byteCodeHistogram, 0, sizeof(byteCodeHistogram));
 #endif
 
@@ -660,6 +663,9 @@ namespace Js
             Assert(!isInitialized || this->globalObject != nullptr);
             CloseNativeCodeGenerator(this->nativeCodeGen);
         }
+#ifdef BGJIT_STATS
+        this->GetThreadContext()->RemoveJitRequests(this);
+#endif
 #endif
         {
             // Take lock on the function bodies to sync with the etw source rundown if any.
@@ -2216,6 +2222,9 @@ namespace Js
 
                 OUTPUT_TRACE_DEBUGONLY(Js::DataCachePhase, _u(" Successfully read compressed parser state cache (%lu bytes) for '%s'\n"), compressedBufferByteCount, url);
 
+#ifdef OUTPUT_TRACE_DEBUGONLY_ENABLED
+                const Js::Tick decompressStart = Js::Tick::Now();
+#endif
                 hr = Js::CompressionUtilities::DecompressBuffer(alloc, compressedBuffer, compressedBufferByteCount, &decompressedBuffer, &decompressedBufferByteCount);
                 if (FAILED(hr))
                 {
@@ -2224,6 +2233,11 @@ namespace Js
                 }
 
                 OUTPUT_TRACE_DEBUGONLY(Js::DataCachePhase, _u(" Decompressed parser state cache %lu -> %lu bytes (%.2f%%) to stream for '%s'\n"), compressedBufferByteCount, decompressedBufferByteCount, (double)compressedBufferByteCount / decompressedBufferByteCount * 100.0, url);
+#ifdef OUTPUT_TRACE_DEBUGONLY_ENABLED
+                const uint64 decompressMicroseconds = (Js::Tick::Now() - decompressStart).ToMicroseconds();
+                OUTPUT_TRACE_DEBUGONLY(Js::DataCachePhase, _u(" Decompression took %llu us (%.2f MB/s) for '%s'\n"), decompressMicroseconds,
+                    decompressMicroseconds == 0 ? 0.0 : (double)decompressedBufferByteCount / decompressMicroseconds, url);
+#endif
             }
 ExitTempAllocator:
             END_TEMP_ALLOCATOR(tempAllocator, this);
@@ -5937,6 +5951,14 @@ ScriptContext::GetJitFuncRangeCache()
                 byteCodeDataSize + byteCodeAuxiliaryDataSize + byteCodeAuxiliaryContextDataSize);
         }
 
+        if (PHASE_STATS1(Js::ParsePhase))
+        {
+            Output::Print(_u(" Total parse arena size: Parses: %d, Used: %d, Allocated: %d\n"),
+                parseCount,
+                parseArenaUsedSize,
+                parseArenaAllocatedSize);
+        }
+
         if (Configuration::Global.flags.BytecodeHist)
         {
             Output::Print(_u("ByteCode Histogram\n"));
@@ -6129,6 +6151,8 @@ ScriptContext::GetJitFuncRangeCache()
                 speculativeJitCount, funcJITCount, funcJitCodeUsed, ((float)(funcJitCodeUsed) / funcJITCount) * 100, bytecodeJITCount, jitCodeUsed, ((float)(jitCodeUsed) / bytecodeJITCount) * 100);
             Output::Print(_u("** LoopJITCount: %6d LoopJitCodeUsed: %6d Usage: %f\n"),
                 loopJITCount, loopJitCodeUsed, ((float)loopJitCodeUsed / loopJITCount) * 100);
+            Output::Print(_u("** RepeatedFromOtherScriptContexts: %6d ByteCodes: %6d\n"),
+                repeatedFuncJITCount, repeatedBytecodeJITCount);
             Output::Print(_u("** TotalInterpretedCalls: %6d MaxFuncInterp: %6d  InterpretedHighPri: %6d \n"),
                 interpretedCount, maxFuncInterpret, interpretedCallsHighPri);
             Output::Print(_u("** ZeroInterpretedFunctions: %6d OneInterpretedFunctions: %6d ZeroInterpretedWithNonZeroBytecode: %6d \n "), zeroInterpretedFunctions, oneInterpretedFunctions, nonZeroBytecodeFunctions);
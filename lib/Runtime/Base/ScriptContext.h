@@ -714,6 +714,9 @@ namespace Js
         uint byteCodeDataSize;
         uint byteCodeAuxiliaryDataSize;
         uint byteCodeAuxiliaryContextDataSize;
+        uint parseCount;
+        uint parseArenaUsedSize;
+        uint parseArenaAllocatedSize;
         uint byteCodeHistogram[static_cast<uint>(OpCode::ByteCodeLast)];
         uint32 forinCache;
         uint32 forinNoCache;
@@ -728,6 +731,8 @@ namespace Js
         uint jitCodeUsed;
         uint funcJitCodeUsed;
         uint speculativeJitCount;
+        uint repeatedFuncJITCount;      // full JIT requests for functions another script context of the thread already queued
+        uint repeatedBytecodeJITCount;
 #endif
 #if DBG
         // Count how many Out of Memory and Stack overflow exceptions happened during the execution
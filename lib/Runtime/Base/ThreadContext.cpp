@@ -141,6 +141,12 @@ ThreadContext::ThreadContext(AllocationPolicyManager * allocationPolicyManager,
 #endif
     sourceCodeSize(0),
     nativeCodeSize(0),
+#ifdef BGJIT_STATS
+    jitRequestSourceMap(nullptr),
+    jitRequestCount(0),
+    crossContextJitRequestCount(0),
+    crossContextJitByteCodeCount(0),
+#endif
     threadAlloc(_u("TC"), GetPageAllocator(), Js::Throw::OutOfMemory),
     inlineCacheThreadInfoAllocator(_u("TC-InlineCacheInfo"), GetPageAllocator(), Js::Throw::OutOfMemory),
     isInstInlineCacheThreadInfoAllocator(_u("TC-IsInstInlineCacheInfo"), GetPageAllocator(), Js::Throw::OutOfMemory),
@@ -470,6 +476,12 @@ ThreadContext::~ThreadContext()
             this->recyclableData->symbolRegistrationMap = nullptr;
         }
 
+        if (this->recyclableData->sharedRegexPrograms != nullptr)
+        {
+            this->recyclableData->sharedRegexPrograms->Clear();
+            this->recyclableData->sharedRegexPrograms = nullptr;
+        }
+
 #ifdef ENABLE_SCRIPT_DEBUGGING
         if (this->recyclableData->returnedValueList != nullptr)
         {
@@ -583,6 +595,19 @@ ThreadContext::~ThreadContext()
     }
 #endif
 
+#ifdef BGJIT_STATS
+    if (this->jitRequestSourceMap != nullptr)
+    {
+        if (PHASE_STATS1(Js::BGJitPhase))
+        {
+            Output::Print(_u("Thread Context: 0x%p, Functions queued for JIT: %u, Repeated from another script context: %u (%u bytecodes)\n"),
+                this, this->jitRequestCount, this->crossContextJitRequestCount, this->crossContextJitByteCodeCount);
+        }
+        HeapDelete(this->jitRequestSourceMap);
+        this->jitRequestSourceMap = nullptr;
+    }
+#endif
+
     Assert(processNativeCodeSize >= nativeCodeSize);
     ::InterlockedExchangeSubtract(&processNativeCodeSize, nativeCodeSize);
 
@@ -923,6 +948,17 @@ ThreadContext::FindPropertyRecord(const char16 * propertyName, int propertyNameL
     return propertyMap->LookupWithKey(Js::HashedCharacterBuffer<char16>(propertyName, propertyNameLength));
 }
 
+const Js::PropertyRecord *
+ThreadContext::FindPropertyRecord(Js::HashedCharacterBuffer<char16> const& propertyName)
+{
+    if (propertyName.GetLength() < 2)
+    {
+        return FindPropertyRecord(propertyName.GetBuffer(), propertyName.GetLength());
+    }
+
+    return propertyMap->LookupWithKey(propertyName);
+}
+
 Js::PropertyRecord const *
 ThreadContext::UncheckedAddPropertyId(__in LPCWSTR propertyName, __in int propertyNameLength, bool bind, bool isSymbol)
 {
@@ -1202,6 +1238,27 @@ ThreadContext::GetOrAddPropertyRecordImpl(JsUtil::CharacterBuffer<char16> proper
     const Js::PropertyRecord * propertyRecord;
     FindPropertyRecord(propertyName.GetBuffer(), propertyName.GetLength(), &propertyRecord);
 
+    return AddOrBindPropertyRecord(propertyName, propertyRecord, bind);
+}
+
+const Js::PropertyRecord *
+ThreadContext::GetOrAddPropertyRecordImpl(Js::HashedCharacterBuffer<char16> const& propertyName, bool bind)
+{
+    // Make sure the recycler is around so that we can take weak references to the property strings
+    EnsureRecycler();
+
+    // Same as above, but the lookup reuses the hash that the caller already has
+    const Js::PropertyRecord * propertyRecord;
+    EnterPinnedScope((volatile void **)&propertyRecord);
+    propertyRecord = FindPropertyRecord(propertyName);
+    LeavePinnedScope();
+
+    return AddOrBindPropertyRecord(propertyName, propertyRecord, bind);
+}
+
+const Js::PropertyRecord *
+ThreadContext::AddOrBindPropertyRecord(JsUtil::CharacterBuffer<char16> const& propertyName, const Js::PropertyRecord * propertyRecord, bool bind)
+{
     if (propertyRecord == nullptr)
     {
         propertyRecord = UncheckedAddPropertyId(propertyName, bind);
@@ -2726,6 +2783,55 @@ ThreadContext::PostSweepRedeferralCallBack()
     this->UpdateRedeferralState();
 }
 
+#ifdef BGJIT_STATS
+void
+ThreadContext::RecordJitRequest(Js::FunctionBody * functionBody)
+{
+    if (!PHASE_STATS1(Js::BGJitPhase))
+    {
+        return;
+    }
+
+    if (this->jitRequestSourceMap == nullptr)
+    {
+        this->jitRequestSourceMap = HeapNew(JitRequestSourceMap, &HeapAllocator::Instance);
+    }
+
+    const hash_t sourceHash = JsUtil::CharacterBuffer<utf8char_t>::StaticGetHashCode(
+        functionBody->GetSource(_u("ThreadContext::RecordJitRequest")), functionBody->LengthInBytes());
+    const uint64 key = ((uint64)sourceHash << 32) | functionBody->GetLocalFunctionId();
+
+    Js::ScriptContext * firstScriptContext = nullptr;
+    if (!this->jitRequestSourceMap->TryGetValue(key, &firstScriptContext))
+    {
+        this->jitRequestSourceMap->Item(key, functionBody->GetScriptContext());
+    }
+    else if (firstScriptContext != functionBody->GetScriptContext())
+    {
+        this->crossContextJitRequestCount++;
+        this->crossContextJitByteCodeCount += functionBody->GetByteCodeCount();
+        functionBody->GetScriptContext()->repeatedFuncJITCount++;
+        functionBody->GetScriptContext()->repeatedBytecodeJITCount += functionBody->GetByteCodeCount();
+    }
+    this->jitRequestCount++;
+}
+
+void
+ThreadContext::RemoveJitRequests(Js::ScriptContext * scriptContext)
+{
+    if (this->jitRequestSourceMap == nullptr)
+    {
+        return;
+    }
+
+    // The map only compares script context pointers, so entries must not outlive their context
+    this->jitRequestSourceMap->MapAndRemoveIf([scriptContext](JitRequestSourceMap::EntryType const& entry) -> bool
+    {
+        return entry.Value() == scriptContext;
+    });
+}
+#endif
+
 bool
 ThreadContext::DoTryRedeferral() const
 {
@@ -4555,6 +4661,47 @@ UnifiedRegex::StandardChars<char16>* ThreadContext::GetStandardChars(__inout_opt
     return standardUnicodeChars;
 }
 
+bool ThreadContext::IsSharedRegexProgramEnabled() const
+{
+#if ENABLE_REGEX_CONFIG_OPTIONS
+    // Profiling and tracing report on the compilation of each pattern
+    if (REGEX_CONFIG_FLAG(RegexProfile) || REGEX_CONFIG_FLAG(RegexTracing))
+    {
+        return false;
+    }
+#endif
+    return !PHASE_OFF1(Js::SharedRegexProgramPhase);
+}
+
+UnifiedRegex::Program* ThreadContext::GetSharedRegexProgram(const UnifiedRegex::RegexKey& key)
+{
+    UnifiedRegex::Program* program = nullptr;
+    if (this->recyclableData->sharedRegexPrograms != nullptr && IsSharedRegexProgramEnabled())
+    {
+        this->recyclableData->sharedRegexPrograms->TryGetValue(key, &program);
+    }
+    return program;
+}
+
+bool ThreadContext::CanAddSharedRegexProgram() const
+{
+    // Shared programs are never freed before the thread context goes away, so only a bounded number are kept
+    return IsSharedRegexProgramEnabled() &&
+        (this->recyclableData->sharedRegexPrograms == nullptr || this->recyclableData->sharedRegexPrograms->Count() < MaxSharedRegexPrograms);
+}
+
+void ThreadContext::AddSharedRegexProgram(const UnifiedRegex::RegexKey& key, UnifiedRegex::Program* program)
+{
+    Assert(CanAddSharedRegexProgram());
+    if (this->recyclableData->sharedRegexPrograms == nullptr)
+    {
+        this->recyclableData->sharedRegexPrograms = RecyclerNew(GetRecycler(), SharedRegexProgramMap, GetRecycler());
+    }
+
+    // The key must refer to the program's own copy of the source so that it lives as long as the entry
+    this->recyclableData->sharedRegexPrograms->AddNew(key, program);
+}
+
 void ThreadContext::CheckScriptInterrupt()
 {
     if (TestThreadContextFlag(ThreadContextFlagCanDisableExecution))
@@ -46,6 +46,7 @@ enum ThreadContextFlags
     ThreadContextFlagNoJIT                         = 0x00000004,
     ThreadContextFlagDisableFatalOnOOM             = 0x00000008,
     ThreadContextFlagNoDynamicThunks               = 0x00000010,
+    ThreadContextFlagStringInterning               = 0x00000020,
 };
 
 const int LS_MAX_STACK_SIZE_KB = 300;
@@ -537,6 +538,7 @@ class ThreadContext sealed :
 private:
     typedef JsUtil::BaseDictionary<uint, Js::SourceDynamicProfileManager*, Recycler, PowerOf2SizePolicy> SourceDynamicProfileManagerMap;
     typedef JsUtil::BaseDictionary<Js::HashedCharacterBuffer<char16>*, const Js::PropertyRecord*, Recycler, PowerOf2SizePolicy, Js::PropertyRecordStringHashComparer> SymbolRegistrationMap;
+    typedef JsUtil::BaseDictionary<UnifiedRegex::RegexKey, UnifiedRegex::Program*, Recycler, PowerOf2SizePolicy> SharedRegexProgramMap;
 
     class SourceDynamicProfileManagerCache
     {
@@ -618,6 +620,10 @@ class ThreadContext sealed :
         // See ES6 (draft 22) 19.4.2.2
         Field(SymbolRegistrationMap*) symbolRegistrationMap;
 
+        // Compiled regex programs shared by the patterns of all script contexts on this thread, keyed by source and flags.
+        // The programs' runtime data lives in the thread allocator, so they stay valid after the context that compiled them closes.
+        Field(SharedRegexProgramMap*) sharedRegexPrograms;
+
 #ifdef ENABLE_SCRIPT_DEBUGGING
         // Just holding the reference to the returnedValueList of the stepController. This way that list will not get recycled prematurely.
         Field(Js::ReturnedValueList *) returnedValueList;
@@ -748,6 +754,15 @@ class ThreadContext sealed :
     static size_t processNativeCodeSize;
     size_t nativeCodeSize;
     size_t sourceCodeSize;
+#ifdef BGJIT_STATS
+    // Maps the (source text hash, local function id) of each function queued for full JIT to the first open script context
+    // that queued it, to measure how much JIT work is repeated for identical code across the script contexts of a thread.
+    typedef JsUtil::BaseDictionary<uint64, Js::ScriptContext *, HeapAllocator> JitRequestSourceMap;
+    JitRequestSourceMap * jitRequestSourceMap;
+    uint jitRequestCount;
+    uint crossContextJitRequestCount;
+    uint crossContextJitByteCodeCount;
+#endif
 
     DateTime::HiResTimer hTimer;
 
@@ -1005,6 +1020,11 @@ class ThreadContext sealed :
         return this->TestThreadContextFlag(ThreadContextFlagNoDynamicThunks);
     }
 
+    bool StringInterningEnabled() const
+    {
+        return this->TestThreadContextFlag(ThreadContextFlagStringInterning);
+    }
+
 #ifdef ENABLE_DEBUG_CONFIG_OPTIONS
     Js::Var GetMemoryStat(Js::ScriptContext* scriptContext);
     void SetAutoProxyName(LPCWSTR objectName);
@@ -1172,6 +1192,7 @@ class ThreadContext sealed :
     void FindPropertyRecord(Js::JavascriptString *pstName, Js::PropertyRecord const ** propertyRecord);
     void FindPropertyRecord(__in LPCWCH propertyName, __in int propertyNameLength, Js::PropertyRecord const ** propertyRecord);
     const Js::PropertyRecord * FindPropertyRecord(const char16 * propertyName, int propertyNameLength);
+    const Js::PropertyRecord * FindPropertyRecord(Js::HashedCharacterBuffer<char16> const& propertyName);
 
     JsUtil::List<const RecyclerWeakReference<Js::PropertyRecord const>*>* FindPropertyIdNoCase(Js::ScriptContext * scriptContext, LPCWSTR propertyName, int propertyNameLength);
     JsUtil::List<const RecyclerWeakReference<Js::PropertyRecord const>*>* FindPropertyIdNoCase(Js::ScriptContext * scriptContext, JsUtil::CharacterBuffer<WCHAR> const& propertyName);
@@ -1187,6 +1208,10 @@ class ThreadContext sealed :
     {
         return GetOrAddPropertyRecordImpl(propertyName, true);
     }
+    const Js::PropertyRecord * GetOrAddPropertyRecordBind(Js::HashedCharacterBuffer<char16> const& propertyName)
+    {
+        return GetOrAddPropertyRecordImpl(propertyName, true);
+    }
     void AddBuiltInPropertyRecord(const Js::PropertyRecord *propertyRecord);
 
     void GetOrAddPropertyId(_In_ LPCWSTR propertyName, _In_ int propertyNameLength, _Out_ Js::PropertyRecord const** propertyRecord);
@@ -1200,6 +1225,8 @@ class ThreadContext sealed :
 
 private:
     const Js::PropertyRecord * GetOrAddPropertyRecordImpl(JsUtil::CharacterBuffer<char16> propertyName, bool bind);
+    const Js::PropertyRecord * GetOrAddPropertyRecordImpl(Js::HashedCharacterBuffer<char16> const& propertyName, bool bind);
+    const Js::PropertyRecord * AddOrBindPropertyRecord(JsUtil::CharacterBuffer<char16> const& propertyName, const Js::PropertyRecord * propertyRecord, bool bind);
     void AddPropertyRecordInternal(const Js::PropertyRecord * propertyRecord);
     void BindPropertyRecord(const Js::PropertyRecord * propertyRecord);
     bool IsDirectPropertyName(const char16 * propertyName, int propertyNameLength);
@@ -1260,6 +1287,11 @@ class ThreadContext sealed :
     static size_t  GetProcessCodeSize() { return processNativeCodeSize; }
     size_t GetSourceSize() { return sourceCodeSize; }
 
+#ifdef BGJIT_STATS
+    void RecordJitRequest(Js::FunctionBody * functionBody);
+    void RemoveJitRequests(Js::ScriptContext * scriptContext);
+#endif
+
     bool DoTryRedeferral() const;
     void TryRedeferral();
     bool DoRedeferFunctionBodies() const;
@@ -1799,6 +1831,13 @@ class ThreadContext sealed :
     UnifiedRegex::StandardChars<uint8>* GetStandardChars(__inout_opt uint8* dummy);
     UnifiedRegex::StandardChars<char16>* GetStandardChars(__inout_opt char16* dummy);
 
+    static const int MaxSharedRegexPrograms = 256;
+    bool IsSharedRegexProgramEnabled() const;
+    UnifiedRegex::Program* GetSharedRegexProgram(const UnifiedRegex::RegexKey& key);
+    bool CanAddSharedRegexProgram() const;
+    void AddSharedRegexProgram(const UnifiedRegex::RegexKey& key, UnifiedRegex::Program* program);
+    ArenaAllocator* GetSharedRegexAllocator() { return &threadAlloc; }
+
     bool IsOptimizedForManyInstances() const { return isOptimizedForManyInstances; }
 
     void OptimizeForManyInstances(const bool optimizeForManyInstances)
@@ -5,6 +5,6 @@
 // NOTE: If there is a merge conflict the correct fix is to make a new GUID.
 // This file was generated with tools/xplatRegenByteCode.py
 
-// {0dd2f753-99b8-4259-b551-10f2b9bf23d1}
+// {8ca478fc-a1f8-4486-8d0d-f2d0362db3aa}
 const GUID byteCodeCacheReleaseFileVersion =
-{ 0x0dd2f753, 0x99b8, 0x4259, {0xb5, 0x51, 0x10, 0xf2, 0xb9, 0xbf, 0x23, 0xd1 } };
+{ 0x8ca478fc, 0xa1f8, 0x4486, {0x8d, 0x0d, 0xf2, 0xd0, 0x36, 0x2d, 0xb3, 0xaa } };
@@ -189,6 +189,7 @@ namespace Js
 struct IndexEntry
 {
     BufferBuilderByte* isPropertyRecord;
+    ConstantSizedBufferBuilderOf<int>* propertyRecordHash;
     int id;
 };
 
@@ -199,6 +200,15 @@ struct StringIndexRecord
     int offset;
     bool isPropertyRecord;
 };
+
+// Non-library byte code also records the hash of each property name as computed by PropertyRecord,
+// so that the reader can register the property ids without rehashing every name.
+// Library byte code keeps the plain StringIndexRecord layout.
+struct HashedStringIndexRecord
+{
+    StringIndexRecord record;
+    hash_t propertyRecordHash; // Only valid if record.isPropertyRecord
+};
 #pragma pack(pop)
 
 typedef JsUtil::BaseDictionary<ByteBuffer*, IndexEntry, ArenaAllocator, PrimeSizePolicy, DefaultComparer> TString16ToId;
@@ -407,6 +417,8 @@ class ByteCodeBufferBuilder
     TString16ToId * string16ToId;
     ScopeInfoToScopeInfoIdMap* scopeInfoToScopeInfoIdMap;
     int nextString16Id;
+    BufferBuilderByte * nextIsPropertyRecord;
+    ConstantSizedBufferBuilderOf<int> * nextPropertyRecordHash;
     int topFunctionId;
     LPCUTF8 utf8Source;
     ScriptContext * scriptContext;
@@ -476,6 +488,8 @@ class ByteCodeBufferBuilder
           scopeInfoRelativeOffsets(_u("ScopeInfo Relative Offsets")),
           scopeInfoTable(_u("ScopeInfo Table")),
           nextString16Id(builtInPropertyCount), // Reserve the built-in property ids
+          nextIsPropertyRecord(nullptr),
+          nextPropertyRecordHash(nullptr),
           topFunctionId(0),
           utf8Source(utf8Source),
           scriptContext(scriptContext),
@@ -673,7 +687,19 @@ class ByteCodeBufferBuilder
         return id ^ SERIALIZER_OBSCURE_PROPERTY_ID;
     };
 
-    int GetString16Id(ByteBuffer * bb, bool isPropertyRecord = false)
+    // Prepend the isPropertyRecord flag and property record hash of the next string's index record.
+    // They are patched later if that string turns out to be a property record.
+    void PrependNextStringIndexFlags()
+    {
+        PrependByte(string16IndexTable, _u("isPropertyRecord"), (BYTE)false);
+        nextIsPropertyRecord = static_cast<BufferBuilderByte*>(string16IndexTable.list->First());
+        if (!GenerateLibraryByteCode())
+        {
+            PrependConstantInt32(string16IndexTable, _u("propertyRecordHash"), 0, &nextPropertyRecordHash);
+        }
+    }
+
+    int GetString16Id(ByteBuffer * bb, bool isPropertyRecord = false, hash_t propertyRecordHash = 0)
     {
         IndexEntry indexEntry;
         if (!string16ToId->TryGetValue(bb, &indexEntry))
@@ -686,18 +712,19 @@ class ByteCodeBufferBuilder
                 // First item in the list is the first string.
                 auto stringIndexEntry = Anew(alloc, BufferBuilderRelativeOffset, _u("First String16 Index"), stringEntry);
                 string16IndexTable.list = regex::ImmutableList<Js::BufferBuilder*>::OfSingle(stringIndexEntry, alloc);
-                PrependByte(string16IndexTable, _u("isPropertyRecord"), (BYTE)isPropertyRecord);
+                PrependNextStringIndexFlags();
             }
 
-            // Get a pointer to the previous entry of isPropertyRecord
-            indexEntry.isPropertyRecord = static_cast<BufferBuilderByte*>(string16IndexTable.list->First());
+            // Get a pointer to the previous entries of isPropertyRecord and propertyRecordHash
+            indexEntry.isPropertyRecord = nextIsPropertyRecord;
+            indexEntry.propertyRecordHash = nextPropertyRecordHash;
 
             // Subsequent strings indexes point one past the end. This way, the size is always computable by subtracting indexes.
             auto stringIndexEntry = Anew(alloc, BufferBuilderRelativeOffset, _u("String16 Index"), stringEntry, sizeInBytes);
             string16IndexTable.list = string16IndexTable.list->Prepend(stringIndexEntry, alloc);
 
             // By default, mark the next string to be not a property record.
-            PrependByte(string16IndexTable, _u("isPropertyRecord"), (BYTE)false);
+            PrependNextStringIndexFlags();
 
             indexEntry.id = nextString16Id;
             string16ToId->Add(bb, indexEntry);
@@ -708,6 +735,10 @@ class ByteCodeBufferBuilder
         if(isPropertyRecord)
         {
             indexEntry.isPropertyRecord->value = isPropertyRecord;
+            if (indexEntry.propertyRecordHash != nullptr)
+            {
+                indexEntry.propertyRecordHash->value = (int)propertyRecordHash;
+            }
         }
         return indexEntry.id;
     }
@@ -853,7 +884,7 @@ class ByteCodeBufferBuilder
         Assert(propertyRecordCheck == propertyRecord);
 #endif
         auto bb = Anew(alloc, ByteBuffer, (uint32)byteCount, (void*)buffer);
-        return GetString16Id(bb, /*isPropertyRecord=*/ true);
+        return GetString16Id(bb, /*isPropertyRecord=*/ true, propertyRecord->GetHashCode());
     }
 
     template<typename TLayout>
@@ -2659,7 +2690,7 @@ class ByteCodeBufferReader
     uint scopeInfoCount;
     const byte * string16s;
     int string16Count;
-    const unaligned StringIndexRecord * string16IndexTable;
+    const byte * string16IndexTable;
     const byte * string16Table;
     int lineInfoCacheCount;
     const byte * lineInfoCaches;
@@ -3014,6 +3045,11 @@ class ByteCodeBufferReader
         return current;
     }
 
+    size_t GetString16IndexRecordSize() const
+    {
+        return isLibraryCode ? sizeof(StringIndexRecord) : sizeof(HashedStringIndexRecord);
+    }
+
     LPCWSTR GetString16ById(int id, bool* isPropertyRecord = nullptr)
     {
         if (id == 0xffffffff)
@@ -3024,7 +3060,7 @@ class ByteCodeBufferReader
         {
             Assert(false);
         }
-        const unaligned StringIndexRecord* record = string16IndexTable + (id - this->expectedBuildInPropertyCount);
+        const unaligned StringIndexRecord* record = (const unaligned StringIndexRecord*)(string16IndexTable + (id - this->expectedBuildInPropertyCount) * GetString16IndexRecordSize());
         if(isPropertyRecord)
         {
             *isPropertyRecord = record->isPropertyRecord;
@@ -3034,6 +3070,19 @@ class ByteCodeBufferReader
         return (LPCWSTR)addressOfString;
     }
 
+    // Get the hash of a property record string that was computed when the byte code was written
+    bool TryGetPropertyRecordHashById(int id, hash_t* propertyRecordHash)
+    {
+        if (isLibraryCode)
+        {
+            return false;
+        }
+        const unaligned HashedStringIndexRecord* record = (const unaligned HashedStringIndexRecord*)string16IndexTable + (id - this->expectedBuildInPropertyCount);
+        Assert(record->record.isPropertyRecord);
+        *propertyRecordHash = record->propertyRecordHash;
+        return true;
+    }
+
     uint32 GetString16LengthById(int id)
     {
         if(!(id >= this->expectedBuildInPropertyCount && id<=string16Count + this->expectedBuildInPropertyCount))
@@ -3185,7 +3234,7 @@ class ByteCodeBufferReader
         current = ReadOffsetAsPointer(current, &scopeInfoRelativeOffsets);
 
         // Read strings header
-        string16IndexTable = (StringIndexRecord*)ReadInt32(string16s, &string16Count);
+        string16IndexTable = ReadInt32(string16s, &string16Count);
         lineCharacterOffsetCacheBuffer = (charcount_t *)ReadInt32(lineInfoCaches, &lineInfoCacheCount);
         byte haslineByteOffsetCacheBuffer;
         current = ReadByte((byte*)lineCharacterOffsetCacheBuffer + sizeof(charcount_t) * lineInfoCacheCount, &haslineByteOffsetCacheBuffer);
@@ -3198,7 +3247,7 @@ class ByteCodeBufferReader
             lineByteOffsetCacheBuffer = nullptr;
         }
 
-        string16Table = (byte*)(string16IndexTable + string16Count + 1);
+        string16Table = string16IndexTable + (string16Count + 1) * GetString16IndexRecordSize();
 
         // string16Table is aligned to 2-bytes
         uint32 string16TableOffset = (uint32)(string16Table - raw);
@@ -4326,6 +4375,14 @@ class ByteCodeBufferReader
                 {
                     (*functionBody)->byteCodeBlock = nullptr;
                 }
+#ifdef ENABLE_SCRIPT_DEBUGGING
+                else if (scriptContext->IsScriptContextInSourceRundownOrDebugMode())
+                {
+                    // Breakpoints are patched into the byte code, and the host's buffer may be a read-only or
+                    // shared mapping. Copy it now, before any frame can be running it.
+                    (*functionBody)->byteCodeBlock = ByteBlock::New(scriptContext->GetRecycler(), buffer, contentLength);
+                }
+#endif
                 else
                 {
                     // TODO: Abstract this out to ByteBlock::New
@@ -4889,8 +4946,19 @@ void ByteCodeCache::PopulateLookupPropertyId(ScriptContext * scriptContext, int
     {
         auto propertyNameLength = reader->GetString16LengthById(idInCache);
 
-        const Js::PropertyRecord * propertyRecord = scriptContext->GetThreadContext()->GetOrAddPropertyRecordBind(
-            JsUtil::CharacterBuffer<char16>(propertyName, propertyNameLength));
+        const Js::PropertyRecord * propertyRecord;
+        hash_t propertyRecordHash;
+        if (reader->TryGetPropertyRecordHashById(idInCache, &propertyRecordHash))
+        {
+            // The hash was computed when the byte code was written, so the lookup doesn't need to rehash the name
+            propertyRecord = scriptContext->GetThreadContext()->GetOrAddPropertyRecordBind(
+                Js::HashedCharacterBuffer<char16>(propertyName, propertyNameLength, propertyRecordHash));
+        }
+        else
+        {
+            propertyRecord = scriptContext->GetThreadContext()->GetOrAddPropertyRecordBind(
+                JsUtil::CharacterBuffer<char16>(propertyName, propertyNameLength));
+        }
 
         propertyIds[realOffset] = propertyRecord->GetPropertyId();
     }
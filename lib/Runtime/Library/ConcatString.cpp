@@ -104,6 +104,12 @@ namespace Js
             Js::JavascriptError::ThrowOutOfMemoryError(scriptContext);
         }
 
+        // ASCII content keeps one byte per character and is only widened if something needs the char16 buffer
+        if (utf8::IsAsciiOnly((LPCUTF8)cString, charCount))
+        {
+            return OneByteString::NewCopyBuffer((const byte *)cString, charCount, scriptContext);
+        }
+
         Recycler * recycler = library->GetRecycler();
         char16* destString = RecyclerNewArrayLeaf(recycler, WCHAR, charCount + 1);
         if (destString == nullptr)
@@ -97,6 +97,24 @@ namespace JSON
         return result;
     }
 
+    Js::Var Parse(LPCWSTR input, uint length, Js::ScriptContext* scriptContext)
+    {
+        // alignment required because of the union in JSONParser::m_token
+        __declspec (align(8)) JSONParser parser(scriptContext, nullptr);
+        Js::Var result = NULL;
+
+        TryFinally([&]()
+        {
+            result = parser.Parse(input, length);
+        },
+            [&](bool/*hasException*/)
+        {
+            parser.Finalizer();
+        });
+
+        return result;
+    }
+
     Js::Var Stringify(Js::RecyclableObject* function, Js::CallInfo callInfo, ...)
     {
         PROBE_STACK(function->GetScriptContext(), Js::Constants::MinStackDefault);
@@ -146,4 +164,17 @@ namespace JSON
         return lazy;
     }
 
+    size_t StringifyToUtf8(Js::Var value, _Out_writes_opt_(bufferSize) utf8char_t* buffer, size_t bufferSize, _Out_ size_t* written, Js::ScriptContext* scriptContext)
+    {
+        PROBE_STACK(scriptContext, Js::Constants::MinStackDefault);
+
+        *written = 0;
+        LazyJSONString* lazy = JSONStringifier::Stringify(scriptContext, value, nullptr, nullptr);
+        if (!lazy)
+        {
+            return 0;
+        }
+        return lazy->CopyToUtf8(buffer, bufferSize, written);
+    }
+
 } // namespace JSON
@@ -15,4 +15,12 @@ namespace JSON
 
     Js::Var Stringify(Js::RecyclableObject* function, Js::CallInfo callInfo, ...);
     Js::Var Parse(Js::RecyclableObject* function, Js::CallInfo callInfo, ...);
+
+    // Parse JSON text that is not held by a JavascriptString. The parse result copies everything it needs,
+    // so the caller may free the text as soon as this returns.
+    Js::Var Parse(LPCWSTR input, uint length, Js::ScriptContext* scriptContext);
+
+    // Stringify a value like JSON.stringify without a replacer or gap, writing the text as UTF-8 into buffer.
+    // Returns the number of bytes the full text needs, or 0 if the value has no JSON representation.
+    size_t StringifyToUtf8(Js::Var value, _Out_writes_opt_(bufferSize) utf8char_t* buffer, size_t bufferSize, _Out_ size_t* written, Js::ScriptContext* scriptContext);
 } // namespace JSON
@@ -209,7 +209,15 @@ namespace JSON
             {
                 // will auto-null-terminate the string (as length=len+1)
                 uint len = m_scanner.GetCurrentStringLen();
-                retVal = Js::JavascriptString::NewCopyBuffer(m_scanner.GetCurrentString(), len, scriptContext);
+                if (scriptContext->GetLibrary()->ShouldInternString(len))
+                {
+                    // Short values such as enum-like tags tend to repeat across a document
+                    retVal = scriptContext->GetLibrary()->GetOrAddInternedString(m_scanner.GetCurrentString(), len);
+                }
+                else
+                {
+                    retVal = Js::JavascriptString::NewCopyBuffer(m_scanner.GetCurrentString(), len, scriptContext);
+                }
                 Scan();
                 return retVal;
             }
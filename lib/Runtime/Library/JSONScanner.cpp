@@ -7,8 +7,46 @@
 
 using namespace Js;
 
+#if defined(_M_IX86) || defined(_M_X64)
+#define JSON_SCANNER_SIMD 1
+#else
+#define JSON_SCANNER_SIMD 0
+#endif
+
 namespace JSON
 {
+#if JSON_SCANNER_SIMD
+    // Skip whole blocks of string characters that ScanString copies through unchanged, i.e. anything but
+    // '"', '\\' and the control characters. Returns the first position in [p, end) it has to look at; a tail
+    // shorter than a block is left to the caller.
+    static inline const char16* SkipPlainStringChars(const char16* p, const char16* end)
+    {
+        const size_t charsPerVector = sizeof(__m128i) / sizeof(char16);
+        const __m128i quote = _mm_set1_epi16('"');
+        const __m128i backslash = _mm_set1_epi16('\\');
+        const __m128i maxControlChar = _mm_set1_epi16(0x1F);
+        const __m128i zero = _mm_setzero_si128();
+
+        while ((size_t)(end - p) >= charsPerVector)
+        {
+            const __m128i chars = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+            // Unsigned saturating subtract is zero exactly for the characters <= 0x1F
+            const __m128i stop = _mm_or_si128(
+                _mm_cmpeq_epi16(_mm_subs_epu16(chars, maxControlChar), zero),
+                _mm_or_si128(_mm_cmpeq_epi16(chars, quote), _mm_cmpeq_epi16(chars, backslash)));
+            const int mask = _mm_movemask_epi8(stop);
+            if (mask != 0)
+            {
+                DWORD index;
+                _BitScanForward(&index, (uint)mask);
+                return p + index / sizeof(char16);
+            }
+            p += charsPerVector;
+        }
+        return p;
+    }
+#endif
+
     // -------- Scanner implementation ------------//
     JSONScanner::JSONScanner()
         : inputText(0), inputLen(0), pToken(0), stringBuffer(0), allocator(0), allocatorObject(0),
@@ -233,6 +271,17 @@ namespace JSON
 
         while (currentChar < inputText + inputLen)
         {
+#if JSON_SCANNER_SIMD
+            {
+                const char16* plainEnd = SkipPlainStringChars(currentChar, inputText + inputLen);
+                bulkLength += (uint)(plainEnd - currentChar);
+                currentChar = plainEnd;
+                if (currentChar >= inputText + inputLen)
+                {
+                    break;
+                }
+            }
+#endif
             ch = ReadNextChar();
             int tempHex;
 
@@ -8,8 +8,14 @@
 namespace Js
 {
 
+JSONUtf16Writer::JSONUtf16Writer(_In_ char16* buffer, charcount_t bufferLength) :
+    endLocation(buffer + bufferLength - 1),
+    currentLocation(buffer)
+{
+}
+
 void
-JSONStringBuilder::AppendCharacter(char16 character)
+JSONUtf16Writer::AppendCharacter(char16 character)
 {
     AssertOrFailFast(this->currentLocation < endLocation);
     *this->currentLocation = character;
@@ -17,7 +23,7 @@ JSONStringBuilder::AppendCharacter(char16 character)
 }
 
 void
-JSONStringBuilder::AppendBuffer(_In_ const char16* buffer, charcount_t length)
+JSONUtf16Writer::AppendBuffer(_In_ const char16* buffer, charcount_t length)
 {
     AssertOrFailFast(this->currentLocation + length <= endLocation);
     wmemcpy_s(this->currentLocation, length, buffer, length);
@@ -25,13 +31,127 @@ JSONStringBuilder::AppendBuffer(_In_ const char16* buffer, charcount_t length)
 }
 
 void
-JSONStringBuilder::AppendString(_In_ JavascriptString* str)
+JSONUtf16Writer::Finish()
+{
+    // Null terminate the string
+    AssertOrFailFast(this->currentLocation == endLocation);
+    *this->currentLocation = _u('\0');
+}
+
+JSONUtf8Writer::JSONUtf8Writer(_Out_writes_opt_(bufferSize) utf8char_t* buffer, size_t bufferSize) :
+    bufferStart(buffer),
+    currentLocation(buffer),
+    endLocation(buffer == nullptr ? nullptr : buffer + bufferSize),
+    requiredLength(0),
+    pendingHighSurrogate(0),
+    truncated(false)
+{
+}
+
+void
+JSONUtf8Writer::AppendEncoded(_In_reads_(length) const utf8char_t* encoded, size_t length)
+{
+    this->requiredLength += length;
+
+    // Once something has been dropped nothing after it is written, so the buffer always holds a prefix
+    if (!this->truncated && static_cast<size_t>(this->endLocation - this->currentLocation) >= length)
+    {
+        js_memcpy_s(this->currentLocation, length, encoded, length);
+        this->currentLocation += length;
+    }
+    else
+    {
+        this->truncated = true;
+    }
+}
+
+void
+JSONUtf8Writer::AppendCodeUnit(char16 character)
+{
+    utf8char_t encoded[3];
+    LPUTF8 encodedEnd = utf8::EncodeFull<false>(character, encoded, encoded + _countof(encoded));
+    this->AppendEncoded(encoded, encodedEnd - encoded);
+}
+
+void
+JSONUtf8Writer::AppendCharacter(char16 character)
+{
+    if (this->pendingHighSurrogate != 0)
+    {
+        const char16 surrogateHigh = this->pendingHighSurrogate;
+        this->pendingHighSurrogate = 0;
+        if (utf8::IsLowSurrogateChar(character))
+        {
+            utf8char_t encoded[4];
+            LPUTF8 encodedEnd = utf8::EncodeSurrogatePair<false>(surrogateHigh, character, encoded);
+            this->AppendEncoded(encoded, encodedEnd - encoded);
+            return;
+        }
+
+        // Lone surrogates can only come from the gap, as string content escapes them
+        this->AppendCodeUnit(surrogateHigh);
+    }
+
+    if (character < 0x80)
+    {
+        const utf8char_t encoded = static_cast<utf8char_t>(character);
+        this->AppendEncoded(&encoded, 1);
+    }
+    else if (utf8::IsHighSurrogateChar(character))
+    {
+        this->pendingHighSurrogate = character;
+    }
+    else
+    {
+        this->AppendCodeUnit(character);
+    }
+}
+
+void
+JSONUtf8Writer::AppendBuffer(_In_ const char16* buffer, charcount_t length)
+{
+    for (charcount_t i = 0; i < length; ++i)
+    {
+        const char16 character = buffer[i];
+        if (character < 0x80 && this->pendingHighSurrogate == 0)
+        {
+            ++this->requiredLength;
+            if (!this->truncated && this->currentLocation < this->endLocation)
+            {
+                *this->currentLocation++ = static_cast<utf8char_t>(character);
+            }
+            else
+            {
+                this->truncated = true;
+            }
+        }
+        else
+        {
+            this->AppendCharacter(character);
+        }
+    }
+}
+
+void
+JSONUtf8Writer::Finish()
+{
+    if (this->pendingHighSurrogate != 0)
+    {
+        this->AppendCodeUnit(this->pendingHighSurrogate);
+        this->pendingHighSurrogate = 0;
+    }
+}
+
+template <typename TWriter>
+void
+JSONStringBuilderT<TWriter>::AppendString(_In_ JavascriptString* str)
 {
     AppendBuffer(str->GetString(), str->GetLength());
 }
 
+template <typename TWriter>
 void
-JSONStringBuilder::AppendEscapeSequence(_In_ const char16 character)
+JSONStringBuilderT<TWriter>::AppendEscapeSequence(_In_ const char16 character)
 {
     // Convert character into a 4 digit hex code (e.g. \u0010)
     this->AppendCharacter(_u('\\'));
@@ -58,17 +178,31 @@ JSONStringBuilder::AppendEscapeSequence(_In_ const char16 character)
     }
 }
 
+template <typename TWriter>
 void
-JSONStringBuilder::EscapeAndAppendString(_In_ JavascriptString* str)
+JSONStringBuilderT<TWriter>::EscapeAndAppendString(_In_ JavascriptString* str)
 {
     const charcount_t strLength = str->GetLength();
 
     // Strings should be surrounded by double quotes
     this->AppendCharacter(_u('"'));
     const char16* bufferStart = str->GetString();
+    const char16* runStart = bufferStart;
     for (const char16* index = bufferStart; index < bufferStart + strLength; ++index)
     {
         char16 currentCharacter = *index;
+
+        // Most characters are copied verbatim, so accumulate them and append the whole run at once
+        if (currentCharacter >= _u(' ') && currentCharacter != _u('"') && currentCharacter != _u('\\') &&
+            !utf8::InRange(currentCharacter, utf8::WCH_UTF16_HIGH_FIRST, utf8::WCH_UTF16_LOW_LAST))
+        {
+            continue;
+        }
+        if (index != runStart)
+        {
+            this->AppendBuffer(runStart, static_cast<charcount_t>(index - runStart));
+        }
+
         switch (currentCharacter)
         {
         case _u('"'):
@@ -125,13 +259,19 @@ JSONStringBuilder::EscapeAndAppendString(_In_ JavascriptString* str)
             }
             break;
         }
+        runStart = index + 1;
     }
 
+    if (runStart != bufferStart + strLength)
+    {
+        this->AppendBuffer(runStart, static_cast<charcount_t>(bufferStart + strLength - runStart));
+    }
     this->AppendCharacter(_u('"'));
 }
 
+template <typename TWriter>
 void
-JSONStringBuilder::AppendGap(uint32 count)
+JSONStringBuilderT<TWriter>::AppendGap(uint32 count)
 {
     for (uint i = 0; i < count; ++i)
     {
@@ -139,8 +279,9 @@ JSONStringBuilder::AppendGap(uint32 count)
     }
 }
 
+template <typename TWriter>
 void
-JSONStringBuilder::AppendObjectString(_In_ JSONObject* valueList)
+JSONStringBuilderT<TWriter>::AppendObjectString(_In_ JSONObject* valueList)
 {
     const uint elementCount = valueList->Count();
     if (elementCount == 0)
@@ -200,8 +341,9 @@ JSONStringBuilder::AppendObjectString(_In_ JSONObject* valueList)
     this->indentLevel = stepbackLevel;
 }
 
+template <typename TWriter>
 void
-JSONStringBuilder::AppendArrayString(_In_ JSONArray* valueArray)
+JSONStringBuilderT<TWriter>::AppendArrayString(_In_ JSONArray* valueArray)
 {
     uint32 length = valueArray->length;
     if (length == 0)
@@ -251,8 +393,9 @@ JSONStringBuilder::AppendArrayString(_In_ JSONArray* valueArray)
     this->indentLevel = stepbackLevel;
 }
 
+template <typename TWriter>
 void
-JSONStringBuilder::AppendJSONPropertyString(_In_ JSONProperty* prop)
+JSONStringBuilderT<TWriter>::AppendJSONPropertyString(_In_ JSONProperty* prop)
 {
     switch (prop->type)
     {
@@ -282,25 +425,23 @@ JSONStringBuilder::AppendJSONPropertyString(_In_ JSONProperty* prop)
     }
 }
 
+template <typename TWriter>
 void
-JSONStringBuilder::Build()
+JSONStringBuilderT<TWriter>::Build()
 {
     this->AppendJSONPropertyString(this->jsonContent);
-    // Null terminate the string
-    AssertOrFailFast(this->currentLocation == endLocation);
-    *this->currentLocation = _u('\0');
+    this->writer->Finish();
 }
 
-JSONStringBuilder::JSONStringBuilder(
+template <typename TWriter>
+JSONStringBuilderT<TWriter>::JSONStringBuilderT(
     _In_ ScriptContext* scriptContext,
     _In_ JSONProperty* jsonContent,
-    _In_ char16* buffer,
-    charcount_t bufferLength,
+    _In_ TWriter* writer,
     _In_opt_ const char16* gap,
     charcount_t gapLength) :
         scriptContext(scriptContext),
-        endLocation(buffer + bufferLength - 1),
-        currentLocation(buffer),
+        writer(writer),
         jsonContent(jsonContent),
         gap(gap),
         gapLength(gapLength),
@@ -308,4 +449,7 @@ JSONStringBuilder::JSONStringBuilder(
 {
 }
 
+template class JSONStringBuilderT<JSONUtf16Writer>;
+template class JSONStringBuilderT<JSONUtf8Writer>;
+
 } //namespace Js
@@ -8,20 +8,56 @@
 namespace Js
 {
 
-class JSONStringBuilder
+// Writes the stringified output into a UTF-16 buffer sized exactly by JSONStringifier
+class JSONUtf16Writer
 {
 private:
-    ScriptContext* scriptContext;
     const char16* endLocation;
     char16* currentLocation;
+public:
+    JSONUtf16Writer(_In_ char16* buffer, charcount_t bufferLength);
+    void AppendCharacter(char16 character);
+    void AppendBuffer(_In_ const char16* buffer, charcount_t length);
+    void Finish();
+};
+
+// Encodes the stringified output as UTF-8 into a caller supplied buffer. Output that does not fit
+// is dropped at a character boundary, but is still counted by GetRequiredLength.
+class JSONUtf8Writer
+{
+private:
+    const utf8char_t* bufferStart;
+    utf8char_t* currentLocation;
+    const utf8char_t* endLocation;
+    size_t requiredLength;
+    char16 pendingHighSurrogate;
+    bool truncated;
+
+    void AppendEncoded(_In_reads_(length) const utf8char_t* encoded, size_t length);
+    void AppendCodeUnit(char16 character);
+public:
+    JSONUtf8Writer(_Out_writes_opt_(bufferSize) utf8char_t* buffer, size_t bufferSize);
+    void AppendCharacter(char16 character);
+    void AppendBuffer(_In_ const char16* buffer, charcount_t length);
+    void Finish();
+    size_t GetRequiredLength() const { return this->requiredLength; }
+    size_t GetWrittenLength() const { return static_cast<size_t>(this->currentLocation - this->bufferStart); }
+};
+
+template <typename TWriter>
+class JSONStringBuilderT
+{
+private:
+    ScriptContext* scriptContext;
+    TWriter* writer;
     JSONProperty* jsonContent;
     const char16* gap;
     charcount_t gapLength;
     uint32 indentLevel;
 
     void AppendGap(uint32 count);
-    void AppendCharacter(char16 character);
-    void AppendBuffer(_In_ const char16* buffer, charcount_t length);
+    void AppendCharacter(char16 character) { this->writer->AppendCharacter(character); }
+    void AppendBuffer(_In_ const char16* buffer, charcount_t length) { this->writer->AppendBuffer(buffer, length); }
     void AppendString(_In_ JavascriptString* str);
     void AppendEscapeSequence(_In_ const char16 character);
     void EscapeAndAppendString(_In_ JavascriptString* str);
@@ -29,14 +65,16 @@ class JSONStringBuilder
     void AppendArrayString(_In_ JSONArray* valueArray);
     void AppendJSONPropertyString(_In_ JSONProperty* prop);
 public:
-    JSONStringBuilder(
+    JSONStringBuilderT(
         _In_ ScriptContext* scriptContext,
         _In_ JSONProperty* jsonContent,
-        _In_ char16* buffer,
-        charcount_t bufferLength,
+        _In_ TWriter* writer,
         _In_opt_ const char16* gap,
         charcount_t gapLength);
     void Build();
 };
 
+typedef JSONStringBuilderT<JSONUtf16Writer> JSONStringBuilder;
+typedef JSONStringBuilderT<JSONUtf8Writer> JSONUtf8StringBuilder;
+
 } // namespace Js
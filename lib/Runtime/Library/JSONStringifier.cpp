@@ -17,7 +17,8 @@ JSONStringifier::JSONStringifier(_In_ ScriptContext* scriptContext) :
     indentLength(0),
     gapLength(0),
     gap(nullptr),
-    propertyList(nullptr)
+    propertyList(nullptr),
+    objectShapeCache(nullptr)
 {
 }
 
@@ -110,6 +111,7 @@ JSONStringifier::AddToPropertyList(_In_ Var item, _Inout_ BVSparse<Recycler>* pr
             PropertyListElement elem;
             elem.propertyName = propertyName;
             elem.propertyRecord = propertyRecord;
+            elem.propertyNameLength = CalculateStringElementLength(propertyName);
             this->propertyList->Push(elem);
         }
     }
@@ -428,6 +430,7 @@ JSONStringifier::ReadArray(_In_ RecyclableObject* arr, _In_ JSONObjectStack* obj
 void
 JSONStringifier::AppendObjectElement(
     _In_ JavascriptString* propertyName,
+    charcount_t propertyNameLength,
     _In_ JSONObject* jsonObject,
     _In_ JSONObjectProperty* prop)
 {
@@ -435,7 +438,7 @@ JSONStringifier::AppendObjectElement(
     if (prop->propertyValue.type != JSONContentType::Undefined)
     {
         // Increase length for the name of the property
-        this->totalStringLength = UInt32Math::Add(this->totalStringLength, CalculateStringElementLength(propertyName));
+        this->totalStringLength = UInt32Math::Add(this->totalStringLength, propertyNameLength);
         // Increment length for concatenation of ":"
         UInt32Math::Inc(this->totalStringLength);
         if (this->gapLength != 0)
@@ -451,6 +454,7 @@ JSONStringifier::AppendObjectElement(
 void
 JSONStringifier::ReadObjectElement(
     _In_ JavascriptString* propertyName,
+    charcount_t propertyNameLength,
     _In_ uint32 numericIndex,
     _In_ RecyclableObject* obj,
     _In_ JSONObject* jsonObject,
@@ -463,12 +467,13 @@ JSONStringifier::ReadObjectElement(
 
     this->ReadProperty(propertyName, obj, &prop.propertyValue, value, objectStack);
 
-    this->AppendObjectElement(propertyName, jsonObject, &prop);
+    this->AppendObjectElement(propertyName, propertyNameLength, jsonObject, &prop);
 }
 
 void
 JSONStringifier::ReadObjectElement(
     _In_ JavascriptString* propertyName,
+    charcount_t propertyNameLength,
     _In_opt_ PropertyRecord const* propertyRecord,
     _In_ RecyclableObject* obj,
     _In_ JSONObject* jsonObject,
@@ -481,7 +486,7 @@ JSONStringifier::ReadObjectElement(
 
     this->ReadProperty(propertyName, obj, &prop.propertyValue, value, objectStack);
 
-    this->AppendObjectElement(propertyName, jsonObject, &prop);
+    this->AppendObjectElement(propertyName, propertyNameLength, jsonObject, &prop);
 }
 
 // Calculates how many additional characters are needed for printing the Object/Array structure
@@ -541,7 +546,7 @@ JSONStringifier::ReadProxy(_In_ JavascriptProxy* proxyObject, _In_ JSONObject* j
             {
                 if (propertyDescriptor.IsEnumerable())
                 {
-                    this->ReadObjectElement(propertyName, propertyRecord, proxyObject, jsonObject, stack);
+                    this->ReadObjectElement(propertyName, CalculateStringElementLength(propertyName), propertyRecord, proxyObject, jsonObject, stack);
                 }
             }
         }
@@ -574,7 +579,7 @@ JSONStringifier::ReadObject(_In_ RecyclableObject* obj, _In_ JSONObjectStack* ob
     {
         FOREACH_SLIST_ENTRY(PropertyListElement, entry, this->propertyList)
         {
-            this->ReadObjectElement(entry.propertyName, entry.propertyRecord, obj, jsonObject, &stack);
+            this->ReadObjectElement(entry.propertyName, entry.propertyNameLength, entry.propertyRecord, obj, jsonObject, &stack);
         }
         NEXT_SLIST_ENTRY;
     }
@@ -592,14 +597,17 @@ JSONStringifier::ReadObject(_In_ RecyclableObject* obj, _In_ JSONObjectStack* ob
             EnumeratorCache* cache = this->scriptContext->GetLibrary()->GetStringifyCache(obj->GetType());
             if (obj->GetEnumerator(&enumerator, EnumeratorFlags::SnapShotSemantics | EnumeratorFlags::EphemeralReference | EnumeratorFlags::UseCache, this->scriptContext, cache))
             {
+                ObjectShape* shape = this->GetObjectShape(obj->GetType());
+                uint32 keyIndex = 0;
                 JavascriptString* propertyName = nullptr;
                 PropertyId nextKey = Constants::NoProperty;
                 while ((propertyName = enumerator.MoveAndGetNext(nextKey)) != nullptr)
                 {
+                    const charcount_t propertyNameLength = this->GetPropertyNameLength(shape, keyIndex++, propertyName);
                     const uint32 numericIndex = enumerator.GetCurrentItemIndex();
                     if (numericIndex != Constants::InvalidSourceIndex)
                     {
-                        this->ReadObjectElement(propertyName, numericIndex, obj, jsonObject, &stack);
+                        this->ReadObjectElement(propertyName, propertyNameLength, numericIndex, obj, jsonObject, &stack);
                     }
                     else
                     {
@@ -609,7 +617,7 @@ JSONStringifier::ReadObject(_In_ RecyclableObject* obj, _In_ JSONObjectStack* ob
                             this->scriptContext->GetOrAddPropertyRecord(propertyName, &propertyRecord);
                             nextKey = propertyRecord->GetPropertyId();
                         }
-                        this->ReadObjectElement(propertyName, propertyRecord, obj, jsonObject, &stack);
+                        this->ReadObjectElement(propertyName, propertyNameLength, propertyRecord, obj, jsonObject, &stack);
                     }
                 }
             }
@@ -627,6 +635,59 @@ JSONStringifier::ReadObject(_In_ RecyclableObject* obj, _In_ JSONObjectStack* ob
     return jsonObject;
 }
 
+JSONStringifier::ObjectShape*
+JSONStringifier::GetObjectShape(_In_ Type* type)
+{
+    if (this->objectShapeCache == nullptr)
+    {
+        this->objectShapeCache = RecyclerNewArrayZ(this->scriptContext->GetRecycler(), ObjectShape, ObjectShapeCacheSize);
+    }
+
+    ObjectShape* shape = &this->objectShapeCache[(((uintptr_t)type) >> PolymorphicInlineCacheShift) & (ObjectShapeCacheSize - 1)];
+    if (shape->type != type)
+    {
+        shape->type = type;
+        shape->keyCount = 0;
+    }
+    return shape;
+}
+
+charcount_t
+JSONStringifier::GetPropertyNameLength(_In_ ObjectShape* shape, uint32 keyIndex, _In_ JavascriptString* propertyName)
+{
+    if (keyIndex < shape->keyCount && shape->keys[keyIndex] == propertyName)
+    {
+        return shape->keyLengths[keyIndex];
+    }
+
+    const charcount_t propertyNameLength = CalculateStringElementLength(propertyName);
+
+    // Only extend the recorded sequence contiguously. A nested object whose type maps to the same
+    // entry resets it, in which case the rest of this object simply isn't recorded.
+    if (keyIndex <= shape->keyCount && keyIndex < MaxObjectShapeKeys)
+    {
+        if (keyIndex == shape->keyCapacity)
+        {
+            Recycler* recycler = this->scriptContext->GetRecycler();
+            const uint32 newCapacity = min(MaxObjectShapeKeys, max(4u, shape->keyCapacity * 2));
+            Field(JavascriptString*)* newKeys = RecyclerNewArrayZ(recycler, Field(JavascriptString*), newCapacity);
+            charcount_t* newKeyLengths = RecyclerNewArrayLeafZ(recycler, charcount_t, newCapacity);
+            if (keyIndex != 0)
+            {
+                CopyArray(newKeys, newCapacity, shape->keys, keyIndex);
+                js_memcpy_s(newKeyLengths, newCapacity * sizeof(charcount_t), shape->keyLengths, keyIndex * sizeof(charcount_t));
+            }
+            shape->keys = newKeys;
+            shape->keyLengths = newKeyLengths;
+            shape->keyCapacity = newCapacity;
+        }
+        shape->keys[keyIndex] = propertyName;
+        shape->keyLengths[keyIndex] = propertyNameLength;
+        shape->keyCount = keyIndex + 1;
+    }
+    return propertyNameLength;
+}
+
 Var
 JSONStringifier::CallReplacerFunction(_In_opt_ RecyclableObject* holder, _In_ JavascriptString* key, _In_ Var value)
 {
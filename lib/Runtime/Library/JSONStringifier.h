@@ -39,15 +39,32 @@ class JSONStringifier
     {
         Field(PropertyRecord const*) propertyRecord;
         Field(JavascriptString*) propertyName;
+        Field(charcount_t) propertyNameLength;
 
         PropertyListElement() {}
         PropertyListElement(const PropertyListElement& other)
-            : propertyRecord(other.propertyRecord), propertyName(other.propertyName)
+            : propertyRecord(other.propertyRecord), propertyName(other.propertyName), propertyNameLength(other.propertyNameLength)
         {}
     };
 
     typedef SList<PropertyListElement, Recycler> PropertyList;
 
+    // Key sequence last seen for objects of a given type. Arrays of same-shaped objects enumerate
+    // the same property strings in the same order, so the escaped length of each key only needs to
+    // be computed for the first element. Entries are validated by key identity, so a stale or
+    // colliding type only costs a recomputation.
+    struct ObjectShape
+    {
+        Field(Type*) type;
+        Field(uint32) keyCount;
+        Field(uint32) keyCapacity;
+        Field(Field(JavascriptString*)*) keys;
+        Field(charcount_t*) keyLengths;
+    };
+
+    static const uint ObjectShapeCacheSize = 8;
+    static const uint32 MaxObjectShapeKeys = 64;
+
     ScriptContext* scriptContext;
     RecyclableObject* replacerFunction;
     PropertyList* propertyList;
@@ -55,6 +72,7 @@ class JSONStringifier
     charcount_t indentLength;
     charcount_t gapLength;
     char16* gap;
+    ObjectShape* objectShapeCache;
 
     Var TryConvertPrimitiveObject(_In_ RecyclableObject* value);
     Var ToJSON(_In_ JavascriptString* key, _In_ RecyclableObject* valueObject);
@@ -65,11 +83,13 @@ class JSONStringifier
 
     void AppendObjectElement(
         _In_ JavascriptString* propertyName,
+        charcount_t propertyNameLength,
         _In_ JSONObject* jsonObject,
         _In_ JSONObjectProperty* prop);
 
     void ReadObjectElement(
         _In_ JavascriptString* propertyName,
+        charcount_t propertyNameLength,
         _In_ uint32 numericIndex,
         _In_ RecyclableObject* obj,
         _In_ JSONObject* jsonObject,
@@ -77,6 +97,7 @@ class JSONStringifier
 
     void ReadObjectElement(
         _In_ JavascriptString* propertyName,
+        charcount_t propertyNameLength,
         _In_opt_ PropertyRecord const* propertyRecord,
         _In_ RecyclableObject* obj,
         _In_ JSONObject* jsonObject,
@@ -91,6 +112,8 @@ class JSONStringifier
     void CalculateStringifiedLength(uint32 propertyCount, charcount_t stepbackLength);
     void ReadProxy(_In_ JavascriptProxy* proxyObject, _In_ JSONObject* jsonObject, _In_ JSONObjectStack* stack);
     JSONObject* ReadObject(_In_ RecyclableObject* obj, _In_ JSONObjectStack* objectStack);
+    ObjectShape* GetObjectShape(_In_ Type* type);
+    charcount_t GetPropertyNameLength(_In_ ObjectShape* shape, uint32 keyIndex, _In_ JavascriptString* propertyName);
     void SetNullProperty(_Out_ JSONProperty* prop);
     void SetNumericProperty(double value, _In_ Var valueVar, _Out_ JSONProperty* prop);
     static charcount_t CalculateStringElementLength(_In_ JavascriptString* str);
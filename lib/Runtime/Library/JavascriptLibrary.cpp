@@ -3178,7 +3178,8 @@ namespace Js
 
     void JavascriptLibrary::InitializeComplexThings()
     {
-        emptyRegexPattern = RegexHelper::CompileDynamic(scriptContext, _u(""), 0, _u(""), 0, false);
+        // The empty regex pattern is compiled on first use (see GetEmptyRegexPattern), most contexts never need it.
+        emptyRegexPattern = nullptr;
 
         Recycler *const recycler = GetRecycler();
 
@@ -3192,7 +3193,7 @@ namespace Js
         // Instead, we just create an ordinary object prototype for RegExp.prototype in InitializePrototypes.
         if (!scriptConfig->IsES6PrototypeChain() && regexPrototype == nullptr)
         {
-            regexPrototype = RecyclerNew(recycler, JavascriptRegExp, emptyRegexPattern,
+            regexPrototype = RecyclerNew(recycler, JavascriptRegExp, GetEmptyRegexPattern(),
                 DynamicType::New(scriptContext, TypeIds_RegEx, objectPrototype, nullptr,
                 DeferredTypeHandler<InitializeRegexPrototype, DefaultDeferredTypeFilter, true>::GetDefaultInstance()));
         }
@@ -3537,6 +3538,7 @@ namespace Js
         vtableAddresses[VTableValue::VtableInvalid] = Js::ScriptContextOptimizationOverrideInfo::InvalidVtable;
         VirtualTableRecorder<Js::PropertyString>::RecordVirtualTableAddress(vtableAddresses, VTableValue::VtablePropertyString);
         VirtualTableRecorder<Js::LazyJSONString>::RecordVirtualTableAddress(vtableAddresses, VTableValue::VtableLazyJSONString);
+        VirtualTableRecorder<Js::OneByteString>::RecordVirtualTableAddress(vtableAddresses, VTableValue::VtableOneByteString);
         VirtualTableRecorder<Js::JavascriptBoolean>::RecordVirtualTableAddress(vtableAddresses, VTableValue::VtableJavascriptBoolean);
         VirtualTableRecorder<Js::JavascriptArray>::RecordVirtualTableAddress(vtableAddresses, VTableValue::VtableJavascriptArray);
         VirtualTableRecorder<Js::Int8Array>::RecordVirtualTableAddress(vtableAddresses, VTableValue::VtableInt8Array);
@@ -5395,10 +5397,19 @@ namespace Js
 
     JavascriptRegExp* JavascriptLibrary::CreateEmptyRegExp()
     {
-        return RecyclerNew(scriptContext->GetRecycler(), JavascriptRegExp, emptyRegexPattern,
+        return RecyclerNew(scriptContext->GetRecycler(), JavascriptRegExp, GetEmptyRegexPattern(),
                            this->GetRegexType());
     }
 
+    UnifiedRegex::RegexPattern * JavascriptLibrary::GetEmptyRegexPattern()
+    {
+        if (emptyRegexPattern == nullptr)
+        {
+            emptyRegexPattern = RegexHelper::CompileDynamic(scriptContext, _u(""), 0, _u(""), 0, false);
+        }
+        return emptyRegexPattern;
+    }
+
 #if ENABLE_TTD
     Js::PropertyId JavascriptLibrary::ExtractPrimitveSymbolId_TTD(Var value)
     {
@@ -6962,6 +6973,59 @@ namespace Js
         return this->symbolMap;
     }
 
+    JavascriptString* JavascriptLibrary::GetOrAddInternedString(__in_ecount(length) const char16* content, charcount_t length)
+    {
+        Assert(ShouldInternString(length));
+
+        if (this->stringInternMap == nullptr)
+        {
+            this->stringInternMap = RecyclerNew(this->recycler, StringInternMap, this->GetRecycler(), 64);
+            this->scriptContext->RegisterWeakReferenceDictionary((JsUtil::IWeakReferenceDictionary*) this->stringInternMap);
+        }
+
+        // The table is keyed by the content hash only and the candidate is compared on lookup. On a
+        // collision the new string simply isn't shared; the entry is taken over once its string dies.
+        const hash_t hashCode = JsUtil::CharacterBuffer<WCHAR>::StaticGetHashCode(content, length);
+        JavascriptString* internedString = nullptr;
+#if ENABLE_WEAK_REFERENCE_REGIONS
+        const bool found = this->stringInternMap->TryGetValue(hashCode, &internedString);
+#else
+        RecyclerWeakReference<JavascriptString>* weakRef = nullptr;
+        const bool found = this->stringInternMap->TryGetValue(hashCode, &weakRef);
+        if (found)
+        {
+            internedString = weakRef->Get();
+        }
+#endif
+
+        if (internedString != nullptr)
+        {
+            if (internedString->GetLength() == length &&
+                JsUtil::CharacterBuffer<WCHAR>::StaticEquals(internedString->GetString(), content, length))
+            {
+#ifdef PROFILE_STRINGS
+                StringProfiler::RecordInternedString(this->scriptContext, length, true);
+#endif
+                return internedString;
+            }
+            return JavascriptString::NewCopyBuffer(content, length, this->scriptContext);
+        }
+
+        JavascriptString* newString = JavascriptString::NewCopyBuffer(content, length, this->scriptContext);
+        if (found || this->stringInternMap->Count() < MaxInternedStringCount)
+        {
+#if ENABLE_WEAK_REFERENCE_REGIONS
+            this->stringInternMap->Item(hashCode, newString);
+#else
+            this->stringInternMap->Item(hashCode, this->recycler->CreateWeakReferenceHandle(newString));
+#endif
+#ifdef PROFILE_STRINGS
+            StringProfiler::RecordInternedString(this->scriptContext, length, false);
+#endif
+        }
+        return newString;
+    }
+
     DynamicObject* JavascriptLibrary::CreateActivationObject()
     {
         AssertMsg(activationObjectType, "Where's activationObjectType?");
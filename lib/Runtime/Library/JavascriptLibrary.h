@@ -366,6 +366,7 @@ namespace Js
         Field(StaticType*) throwErrorObjectType;
         Field(PropertyStringCacheMap*) propertyStringMap;
         Field(SymbolCacheMap*) symbolMap;
+        Field(StringInternMap*) stringInternMap;
         Field(ConstructorCache*) builtInConstructorCache;
 
         Field(DynamicObject*) chakraLibraryObject;
@@ -574,6 +575,7 @@ namespace Js
             inDispatchProfileMode(false),
             propertyStringMap(nullptr),
             symbolMap(nullptr),
+            stringInternMap(nullptr),
             parseIntFunctionObject(nullptr),
             evalFunctionObject(nullptr),
             parseFloatFunctionObject(nullptr),
@@ -812,7 +814,7 @@ namespace Js
         JavascriptFunction* GetDebugObjectNonUserGetterFunction() const { return debugObjectNonUserGetterFunction; }
         JavascriptFunction* GetDebugObjectNonUserSetterFunction() const { return debugObjectNonUserSetterFunction; }
 
-        UnifiedRegex::RegexPattern * GetEmptyRegexPattern() const { return emptyRegexPattern; }
+        UnifiedRegex::RegexPattern * GetEmptyRegexPattern();
         JavascriptFunction* GetRegexExecFunction() const { return regexExecFunction; }
         JavascriptFunction* GetRegexFlagsGetterFunction() const { return regexFlagsGetterFunction; }
         JavascriptFunction* GetRegexGlobalGetterFunction() const { return regexGlobalGetterFunction; }
@@ -1185,6 +1187,16 @@ namespace Js
         PropertyStringCacheMap* EnsurePropertyStringMap();
         SymbolCacheMap* EnsureSymbolMap();
 
+        // Interning of short strings created at runtime, enabled by the host with
+        // JsRuntimeAttributeEnableStringInterning. The table only holds weak references, so
+        // an interned string goes away with its last user and its entry is dropped after the next GC.
+        static const charcount_t MinInternedStringLength = 2;
+        static const charcount_t MaxInternedStringLength = 32;
+        static const int MaxInternedStringCount = 4096;
+
+        inline bool ShouldInternString(charcount_t length) const;
+        JavascriptString* GetOrAddInternedString(__in_ecount(length) const char16* content, charcount_t length);
+
         template <typename TProperty> WeakPropertyIdMap<TProperty>* GetPropertyMap();
         template <> PropertyStringCacheMap* GetPropertyMap<PropertyString>() { return this->propertyStringMap; }
         template <> SymbolCacheMap* GetPropertyMap<JavascriptSymbol>() { return this->symbolMap; }
@@ -33,6 +33,13 @@ namespace Js
         return AddFunctionToLibraryObject(object, scriptContext->GetOrAddPropertyIdTracked(propertyName), functionInfo, length);
     }
 
+    inline bool JavascriptLibrary::ShouldInternString(charcount_t length) const
+    {
+        return length >= MinInternedStringLength && length <= MaxInternedStringLength
+            && scriptContext->GetThreadContext()->StringInterningEnabled()
+            && !PHASE_OFF1(StringInterningPhase);
+    }
+
     inline void JavascriptLibrary::CheckAndInvalidateIsConcatSpreadableCache(PropertyId propertyId, ScriptContext *scriptContext)
     {
         if (!PHASE_OFF1(IsConcatSpreadableCachePhase) && propertyId == PropertyIds::_symbolIsConcatSpreadable)
@@ -343,6 +343,56 @@ namespace Js
         return str[index];
     }
 
+    JavascriptString* JavascriptString::GetTreeNodeContaining(_Inout_ charcount_t* start, charcount_t length)
+    {
+        AssertOrFailFast(*start <= this->GetLength() && length <= this->GetLength() - *start);
+
+        JavascriptString* node = this;
+        charcount_t nodeStart = *start;
+        for (uint depth = 0; depth < MaxTreeWalkDepth && !node->IsFinalized(); ++depth)
+        {
+            JavascriptString * const * items;
+            const int itemCount = node->GetRandomAccessItemsFromConcatString(items);
+            if (itemCount < 0 || itemCount > MaxTreeWalkItemCount)
+            {
+                break;
+            }
+
+            JavascriptString* child = nullptr;
+            charcount_t childStart = nodeStart;
+            for (int i = 0; i < itemCount; ++i)
+            {
+                JavascriptString* item = items[i];
+                if (item == nullptr)
+                {
+                    continue;
+                }
+
+                const charcount_t itemLength = item->GetLength();
+                if (childStart < itemLength)
+                {
+                    if (length <= itemLength - childStart)
+                    {
+                        child = item;
+                    }
+                    break;
+                }
+                childStart -= itemLength;
+            }
+
+            if (child == nullptr)
+            {
+                // The range spans more than one child
+                break;
+            }
+            node = child;
+            nodeStart = childStart;
+        }
+
+        *start = nodeStart;
+        return node;
+    }
+
     void JavascriptString::CopyHelper(__out_ecount(countNeeded) char16 *dst, __in_ecount(countNeeded) const char16 * str, charcount_t countNeeded)
     {
         switch(countNeeded)
@@ -1080,7 +1130,15 @@ namespace Js
         {
             const char16* searchStr = searchString->GetString();
             const char16* inputStr = pThis->GetString();
-            if (searchLen == 1)
+            if (UnifiedRegex::FirstLastCharLiteralSearch::IsPreferred(searchLen))
+            {
+                CharCount offset = position;
+                if (UnifiedRegex::FirstLastCharLiteralSearch::Find(inputStr, len, offset, searchStr, searchLen))
+                {
+                    result = offset;
+                }
+            }
+            else if (searchLen == 1)
             {
                 int i = position;
                 for(; i < len && inputStr[i] != *searchStr ; i++);
@@ -3527,6 +3585,12 @@ namespace Js
         uint stringLen = stringLenOrig - start;
         uint substringLen = substring->GetLength();
 
+        if (UnifiedRegex::FirstLastCharLiteralSearch::IsPreferred(substringLen))
+        {
+            CharCount offset = start;
+            return UnifiedRegex::FirstLastCharLiteralSearch::Find(stringOrig, stringLenOrig, offset, substringSz, substringLen) ? offset : (uint)-1;
+        }
+
         if (useBoyerMoore && substringLen > 2)
         {
             JmpTable jmpTable;
@@ -44,6 +44,11 @@ namespace Js
 
         static const charcount_t MaxCharLength = INT_MAX - 1;  // Max number of chars not including '\0'.
 
+        // Limits for resolving a character range to a part of a concat tree. Past these it is cheaper to
+        // flatten the node reached so far than to keep walking it on every access.
+        static const uint MaxTreeWalkDepth = 8;
+        static const int MaxTreeWalkItemCount = 16;
+
     protected:
         static const byte MaxCopyRecursionDepth = 3;
 
@@ -109,6 +114,10 @@ namespace Js
         virtual int GetRandomAccessItemsFromConcatString(Js::JavascriptString * const *& items) const { return -1; }
         virtual bool IsTree() const { return false; }
 
+        // Returns the smallest node of this string's concat tree that holds [*start, *start + length), and makes
+        // *start relative to it. Returns this string itself if it is flat or the range spans several children.
+        JavascriptString* GetTreeNodeContaining(_Inout_ charcount_t* start, charcount_t length);
+
         virtual BOOL SetItem(uint32 index, Var value, PropertyOperationFlags propertyOperationFlags) override;
         virtual BOOL DeleteItem(uint32 index, PropertyOperationFlags propertyOperationFlags) override;
         virtual PropertyQueryFlags HasItemQuery(uint32 index) override sealed;
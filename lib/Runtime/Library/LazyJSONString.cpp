@@ -186,11 +186,11 @@ LazyJSONString::GetSz()
     Recycler* recycler = GetScriptContext()->GetRecycler();
     char16* target = RecyclerNewArrayLeaf(recycler, char16, allocSize);
 
+    JSONUtf16Writer writer(target, allocSize);
     JSONStringBuilder builder(
         this->GetScriptContext(),
         this->jsonContent,
-        target,
-        allocSize,
+        &writer,
         this->gap,
         this->gapLength);
 
@@ -205,6 +205,32 @@ LazyJSONString::GetSz()
     return target;
 }
 
+size_t
+LazyJSONString::CopyToUtf8(_Out_writes_opt_(bufferSize) utf8char_t* buffer, size_t bufferSize, _Out_ size_t* written)
+{
+    JSONUtf8Writer writer(buffer, bufferSize);
+    if (this->IsFinalized())
+    {
+        writer.AppendBuffer(this->UnsafeGetBuffer(), this->GetLength());
+        writer.Finish();
+    }
+    else
+    {
+        // Encode straight from the JSON content so no UTF-16 copy of the output is ever materialized
+        JSONUtf8StringBuilder builder(
+            this->GetScriptContext(),
+            this->jsonContent,
+            &writer,
+            this->gap,
+            this->gapLength);
+
+        builder.Build();
+    }
+
+    *written = writer.GetWrittenLength();
+    return writer.GetRequiredLength();
+}
+
 template <> bool VarIsImpl<LazyJSONString>(RecyclableObject* obj)
 {
     return VirtualTableInfo<LazyJSONString>::HasVirtualTable(obj);
@@ -105,6 +105,10 @@ class LazyJSONString : public JavascriptString
 
     const char16* GetSz() override sealed;
 
+    // Writes the string as UTF-8 into the buffer, truncating at a character boundary if it doesn't fit.
+    // Returns the number of bytes needed for the whole string.
+    size_t CopyToUtf8(_Out_writes_opt_(bufferSize) utf8char_t* buffer, size_t bufferSize, _Out_ size_t* written);
+
     virtual VTableValue DummyVirtualFunctionToHinderLinkerICF()
     {
         return VTableValue::VtableLazyJSONString;
@@ -0,0 +1,113 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+#include "RuntimeLibraryPch.h"
+
+namespace Js
+{
+
+OneByteString::OneByteString(_In_reads_(length) const byte* oneByteBuffer, charcount_t length, _In_ StaticType* type) :
+    JavascriptString(type),
+    oneByteBuffer(oneByteBuffer),
+    unused(nullptr)
+{
+    // Use SetLength to ensure length is valid
+    SetLength(length);
+}
+
+OneByteString*
+OneByteString::NewCopyBuffer(_In_reads_(length) const byte* content, charcount_t length, _In_ ScriptContext* scriptContext)
+{
+    Recycler* recycler = scriptContext->GetRecycler();
+    byte* buffer = RecyclerNewArrayLeaf(recycler, byte, length);
+    js_memcpy_s(buffer, length, content, length);
+    return RecyclerNew(recycler, OneByteString, buffer, length, scriptContext->GetLibrary()->GetStringTypeStatic());
+}
+
+const char16*
+OneByteString::GetSz()
+{
+    if (this->IsFinalized())
+    {
+        return this->UnsafeGetBuffer();
+    }
+
+    const charcount_t allocSize = this->SafeSzSize();
+
+    Recycler* recycler = GetScriptContext()->GetRecycler();
+    char16* target = RecyclerNewArrayLeaf(recycler, char16, allocSize);
+
+    Widen(this->oneByteBuffer, this->GetLength(), target);
+    target[this->GetLength()] = _u('\0');
+
+    this->SetBuffer(target);
+
+    // The char16 buffer is now the only copy we need
+    this->oneByteBuffer = nullptr;
+    LiteralStringWithPropertyStringPtr::ConvertString(this);
+
+    return target;
+}
+
+void
+OneByteString::GetPropertyRecord(_Out_ PropertyRecord const** propertyRecord, bool dontLookupFromDictionary)
+{
+    if (dontLookupFromDictionary)
+    {
+        *propertyRecord = nullptr;
+        return;
+    }
+
+    // Widen first so the record found here is cached on the LiteralStringWithPropertyStringPtr we turn into
+    this->GetSz();
+    ((LiteralStringWithPropertyStringPtr*)this)->GetPropertyRecordImpl(propertyRecord, dontLookupFromDictionary);
+}
+
+void
+OneByteString::CachePropertyRecord(_In_ PropertyRecord const* propertyRecord)
+{
+    // The property record owns a char16 copy of the string data, so use that instead of widening our own
+    // and transform this instance into a more efficient type.
+    this->oneByteBuffer = nullptr;
+    LiteralStringWithPropertyStringPtr* converted = LiteralStringWithPropertyStringPtr::ConvertString(this);
+    converted->CachePropertyRecordImpl(propertyRecord);
+}
+
+void
+OneByteString::CopyVirtual(
+    _Out_writes_(m_charLength) char16 *const buffer,
+    StringCopyInfoStack &nestedStringTreeCopyInfos,
+    const byte recursionDepth)
+{
+    Assert(buffer);
+    Assert(!this->IsFinalized());
+    Widen(this->oneByteBuffer, this->GetLength(), buffer);
+}
+
+void
+OneByteString::Widen(_In_reads_(length) const byte* source, charcount_t length, _Out_writes_(length) char16* target)
+{
+    for (charcount_t i = 0; i < length; ++i)
+    {
+        target[i] = static_cast<char16>(source[i]);
+    }
+}
+
+size_t
+OneByteString::GetAllocatedByteCount() const
+{
+    if (!this->IsFinalized())
+    {
+        return this->GetLength() * sizeof(byte);
+    }
+    return JavascriptString::GetAllocatedByteCount();
+}
+
+template <> bool VarIsImpl<OneByteString>(RecyclableObject* obj)
+{
+    return VirtualTableInfo<OneByteString>::HasVirtualTable(obj);
+}
+
+} // namespace Js
@@ -0,0 +1,49 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+#pragma once
+
+namespace Js
+{
+// An ASCII string stored one byte per character. The char16 buffer is only built when something asks
+// for it through GetSz, at which point the one-byte buffer is dropped and the string becomes a
+// LiteralStringWithPropertyStringPtr, so it can cache its property record when used as a key. Until
+// then concat flattening and the JSRT copy APIs read the bytes directly.
+class OneByteString : public JavascriptString
+{
+private:
+    Field(const byte*) oneByteBuffer;
+    Field(void const *) unused; // Room for LiteralStringWithPropertyStringPtr's fields; the recycler bucket has it anyway
+
+    static void Widen(_In_reads_(length) const byte* source, charcount_t length, _Out_writes_(length) char16* target);
+
+protected:
+    DEFINE_VTABLE_CTOR(OneByteString, JavascriptString);
+
+    virtual void CopyVirtual(_Out_writes_(m_charLength) char16 *const buffer, StringCopyInfoStack &nestedStringTreeCopyInfos, const byte recursionDepth) override sealed;
+
+public:
+    OneByteString(_In_reads_(length) const byte* oneByteBuffer, charcount_t length, _In_ StaticType* type);
+
+    static OneByteString* NewCopyBuffer(_In_reads_(length) const byte* content, charcount_t length, _In_ ScriptContext* scriptContext);
+
+    // Returns the one-byte characters, or nullptr once the string has been widened
+    const byte* GetOneByteBuffer() const { return this->IsFinalized() ? nullptr : this->oneByteBuffer; }
+
+    const char16* GetSz() override sealed;
+    void GetPropertyRecord(_Out_ PropertyRecord const** propertyRecord, bool dontLookupFromDictionary = false) override sealed;
+    void CachePropertyRecord(_In_ PropertyRecord const* propertyRecord) override sealed;
+    size_t GetAllocatedByteCount() const override;
+
+    virtual VTableValue DummyVirtualFunctionToHinderLinkerICF()
+    {
+        return VTableValue::VtableOneByteString;
+    }
+
+}; // class OneByteString
+
+template <> bool VarIsImpl<OneByteString>(RecyclableObject* obj);
+
+} // namespace Js
@@ -24,6 +24,14 @@ namespace Js
         embeddedNULStrings(0),
         emptyStrings(0),
         singleCharStrings(0),
+        flattenedTrees(0),
+        flattenedChars(0),
+        treeReads(0),
+        internedStrings(0),
+        internHits(0),
+        internedChars(0),
+        copiedOutSlices(0),
+        copiedOutParentChars(0),
         stringConcatMetrics(&allocator, 43)
     {
     }
@@ -235,6 +243,10 @@ namespace Js
         Output::Print(_u("Max string length is %u chars\n"), maxLength);
         Output::Print(_u("%u empty strings (Literals or BufferString) were requested\n"), emptyStrings);
         Output::Print(_u("%u single char strings (Literals or BufferString) were requested\n"), singleCharStrings);
+        Output::Print(_u("%u string trees were flattened, copying %llu bytes\n"), flattenedTrees, flattenedChars * sizeof(char16));
+        Output::Print(_u("%u substring reads were served without flattening a tree\n"), treeReads);
+        Output::Print(_u("%u strings were interned, %u requests were served by an interned string, saving %llu bytes\n"), internedStrings, internHits, internedChars * sizeof(char16));
+        Output::Print(_u("%u short slices were copied out of large strings instead of referencing %llu bytes of parent buffers\n"), copiedOutSlices, copiedOutParentChars * sizeof(char16));
         if( this->embeddedNULStrings == 0 )
         {
             Output::Print(_u("No embedded NULs were detected\n"));
@@ -335,6 +347,51 @@ namespace Js
         }
     }
 
+    /*static*/ void StringProfiler::RecordFlatten( ScriptContext* scriptContext, uint length )
+    {
+        StringProfiler* stringProfiler = scriptContext->GetStringProfiler();
+        if( stringProfiler && !stringProfiler->IsOnWrongThread() )
+        {
+            stringProfiler->flattenedTrees++;
+            stringProfiler->flattenedChars += length;
+        }
+    }
+
+    /*static*/ void StringProfiler::RecordTreeRead( ScriptContext* scriptContext )
+    {
+        StringProfiler* stringProfiler = scriptContext->GetStringProfiler();
+        if( stringProfiler )
+        {
+            ::InterlockedIncrement( &stringProfiler->treeReads );
+        }
+    }
+
+    /*static*/ void StringProfiler::RecordInternedString( ScriptContext* scriptContext, uint length, bool isHit )
+    {
+        StringProfiler* stringProfiler = scriptContext->GetStringProfiler();
+        if( stringProfiler && !stringProfiler->IsOnWrongThread() )
+        {
+            if( isHit )
+            {
+                stringProfiler->internHits++;
+                stringProfiler->internedChars += length;
+            }
+            else
+            {
+                stringProfiler->internedStrings++;
+            }
+        }
+    }
+
+    /*static*/ void StringProfiler::RecordSubStringCopyOut( ScriptContext* scriptContext, uint length, uint parentLength )
+    {
+        StringProfiler* stringProfiler = scriptContext->GetStringProfiler();
+        if( stringProfiler && !stringProfiler->IsOnWrongThread() )
+        {
+            stringProfiler->copiedOutSlices++;
+            stringProfiler->copiedOutParentChars += parentLength;
+        }
+    }
 
 } // namespace Js
 
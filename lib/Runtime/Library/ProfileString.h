@@ -119,6 +119,17 @@ namespace Js
         uint emptyStrings;      // # of requests for zero-length strings (literals or BufferStrings)
         uint singleCharStrings; // # of requests for single-char strings (literals of BufferStrings)
 
+        uint flattenedTrees;     // # of concat trees and compound strings copied into a flat buffer
+        uint64 flattenedChars;   // Total chars copied by those flattens
+        uint treeReads;          // # of substring requests served from a part of a tree without flattening it
+
+        uint internedStrings;    // # of strings added to the library's intern table
+        uint internHits;         // # of requests served by an already interned string
+        uint64 internedChars;    // Total chars of strings that didn't have to be allocated because of those hits
+
+        uint copiedOutSlices;    // # of short slices of large strings that were copied instead of referencing the parent
+        uint64 copiedOutParentChars; // Total length of the parents those slices would otherwise have kept alive
+
         JsUtil::BaseDictionary<uint, StringMetrics, ArenaAllocator> stringLengthMetrics;
 
         struct UintUintPair
@@ -181,6 +192,10 @@ namespace Js
         static void RecordConcatenation( ScriptContext* scriptContext, uint lenLeft, uint lenRight, ConcatType type = ConcatType_Unknown);
         static void RecordEmptyStringRequest( ScriptContext* scriptContext );
         static void RecordSingleCharStringRequest( ScriptContext* scriptContext );
+        static void RecordFlatten( ScriptContext* scriptContext, uint length );
+        static void RecordTreeRead( ScriptContext* scriptContext );
+        static void RecordInternedString( ScriptContext* scriptContext, uint length, bool isHit );
+        static void RecordSubStringCopyOut( ScriptContext* scriptContext, uint length, uint parentLength );
     };
 } // namespace Js
 
@@ -169,7 +169,6 @@ namespace Js
 #ifdef PROFILE_EXEC
         scriptContext->ProfileBegin(Js::RegexCompilePhase);
 #endif
-        ArenaAllocator* rtAllocator = scriptContext->RegexAllocator();
 #if ENABLE_REGEX_CONFIG_OPTIONS
         UnifiedRegex::DebugWriter *dw = 0;
         if (REGEX_CONFIG_FLAG(RegexDebug))
@@ -200,6 +199,25 @@ namespace Js
             return pattern;
         }
 
+        // Another script context on this thread may already have compiled the same source and flags. The flags are
+        // only checked here; if they're ill-formed the parser below reports the error.
+        ThreadContext* threadContext = scriptContext->GetThreadContext();
+        UnifiedRegex::RegexFlags sharedFlags = UnifiedRegex::NoRegexFlags;
+        if (GetFlags(scriptContext, pszOpts, cszOpts, sharedFlags))
+        {
+            UnifiedRegex::Program* sharedProgram = UnifiedRegex::RegexPattern::GetSharedProgram(scriptContext, psz, csz, sharedFlags);
+            if (sharedProgram != nullptr)
+            {
+#ifdef PROFILE_EXEC
+                scriptContext->ProfileEnd(Js::RegexCompilePhase);
+#endif
+                return UnifiedRegex::RegexPattern::NewWithSharedProgram(scriptContext, sharedProgram, isLiteralSource);
+            }
+        }
+
+        const bool shareProgram = threadContext->CanAddSharedRegexProgram();
+        ArenaAllocator* rtAllocator = shareProgram ? threadContext->GetSharedRegexAllocator() : scriptContext->RegexAllocator();
+
 #if ENABLE_REGEX_CONFIG_OPTIONS
         if (REGEX_CONFIG_FLAG(RegexProfile))
             scriptContext->GetRegexStatsDatabase()->BeginProfile();
@@ -235,7 +253,9 @@ namespace Js
         UnifiedRegex::Program* program = UnifiedRegex::Program::New(recycler, flags);
         parser.CaptureSourceAndGroups(recycler, program, psz, csz, csz);
 
-        UnifiedRegex::RegexPattern* pattern = UnifiedRegex::RegexPattern::New(scriptContext, program, isLiteralSource);
+        UnifiedRegex::RegexPattern* pattern = shareProgram
+            ? UnifiedRegex::RegexPattern::NewWithSharedProgram(scriptContext, program, isLiteralSource)
+            : UnifiedRegex::RegexPattern::New(scriptContext, program, isLiteralSource);
 
 #if ENABLE_REGEX_CONFIG_OPTIONS
         if (REGEX_CONFIG_FLAG(RegexProfile))
@@ -275,6 +295,12 @@ namespace Js
 #endif
 
         END_TEMP_ALLOCATOR(ctAllocator, scriptContext);
+
+        if (shareProgram)
+        {
+            pattern->AddToSharedPrograms();
+        }
+
 #ifdef PROFILE_EXEC
         scriptContext->ProfileEnd(Js::RegexCompilePhase);
 #endif
@@ -1518,21 +1544,25 @@ namespace Js
     {
         Assert(endExclusive >= startInclusive);
         Assert(endExclusive <= input->GetLength());
-        CharCount length = endExclusive - startInclusive;
-        JavascriptString* subString;
+        ary->DirectAppendItem(NewSplitPiece(scriptContext, input, startInclusive, endExclusive - startInclusive));
+    }
+
+    JavascriptString* RegexHelper::NewSplitPiece(ScriptContext* scriptContext, JavascriptString* input, CharCount offset, CharCount length)
+    {
         if (length == 0)
         {
-            subString = scriptContext->GetLibrary()->GetEmptyString();
+            return scriptContext->GetLibrary()->GetEmptyString();
         }
         else if (length == 1)
         {
-            subString = scriptContext->GetLibrary()->GetCharStringCache().GetStringForChar(input->GetString()[startInclusive]);
+            return scriptContext->GetLibrary()->GetCharStringCache().GetStringForChar(input->GetString()[offset]);
         }
-        else
+        else if (scriptContext->GetLibrary()->ShouldInternString(length))
         {
-            subString = SubString::New(input, startInclusive, length);
+            // Splitting delimited records tends to produce the same short field values over and over
+            return scriptContext->GetLibrary()->GetOrAddInternedString(input->GetString() + offset, length);
         }
-        ary->DirectAppendItem(subString);
+        return SubString::New(input, offset, length);
     }
 
     inline UnifiedRegex::RegexPattern *RegexHelper::GetSplitPattern(ScriptContext* scriptContext, JavascriptRegExp *regularExpression)
@@ -1884,14 +1914,14 @@ namespace Js
                 offset = JavascriptString::strstr(input, match, false, prevOffset);
                 if (offset != CharCountFlag)
                 {
-                    ary->DirectSetItemAt(i++, SubString::New(input, prevOffset, offset-prevOffset));
+                    ary->DirectSetItemAt(i++, NewSplitPiece(scriptContext, input, prevOffset, offset - prevOffset));
                     offset += max(matchLen, static_cast<CharCount>(1));
                     if (offset > input->GetLength())
                         break;
                 }
                 else
                 {
-                    ary->DirectSetItemAt(i++, SubString::New(input, prevOffset, input->GetLength() - prevOffset));
+                    ary->DirectSetItemAt(i++, NewSplitPiece(scriptContext, input, prevOffset, input->GetLength() - prevOffset));
                     break;
                 }
             }
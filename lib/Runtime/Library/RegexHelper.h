@@ -118,6 +118,7 @@ namespace Js
 
     private:
         static void AppendSubString(ScriptContext* scriptContext, JavascriptArray* ary, JavascriptString* input, CharCount startInclusive, CharCount endExclusive);
+        static JavascriptString* NewSplitPiece(ScriptContext* scriptContext, JavascriptString* input, CharCount offset, CharCount length);
         template <bool updateHistory>
         static Var RegexMatchImpl(ScriptContext* scriptContext, RecyclableObject* thisObj, JavascriptString* input, bool noResult, void *const stackAllocationPointer = nullptr);
         static bool IsRegexSymbolMatchObservable(RecyclableObject* instance, ScriptContext* scriptContext);
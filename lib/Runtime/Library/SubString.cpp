@@ -8,11 +8,12 @@ namespace Js
 {
     DEFINE_RECYCLER_TRACKER_PERF_COUNTER(SubString);
 
-    inline SubString::SubString(void const * originalFullStringReference, const char16* subString, charcount_t length, ScriptContext *scriptContext) :
+    inline SubString::SubString(void const * originalFullStringReference, charcount_t originalFullStringLength, const char16* subString, charcount_t length, ScriptContext *scriptContext) :
         JavascriptString(scriptContext->GetLibrary()->GetStringTypeStatic())
     {
         this->SetBuffer(subString);
         this->originalFullStringReference = originalFullStringReference;
+        this->originalFullStringLength = originalFullStringLength;
         this->SetLength(length);
 
 #ifdef PROFILE_STRINGS
@@ -34,7 +35,40 @@ namespace Js
         Recycler* recycler = scriptContext->GetRecycler();
 
         AssertOrFailFast(string->GetLength() >= start + length);
+
+        if (length == 1)
+        {
+            return scriptContext->GetLibrary()->GetCharStringCache().GetStringForChar(string->GetItem(start));
+        }
+
+        // A slice that falls within one part of a concat tree only needs that part to be flat
+        if (!string->IsFinalized() && string->IsTree())
+        {
+            JavascriptString* node = string->GetTreeNodeContaining(&start, length);
+#ifdef PROFILE_STRINGS
+            if (node != string)
+            {
+                StringProfiler::RecordTreeRead(scriptContext);
+            }
+#endif
+            string = node;
+        }
+
         const char16 * subString = string->GetString() + start;
+
+        // The new view would keep alive the whole buffer the parent refers to. For a SubString parent that is the
+        // buffer of the string it was sliced from, not just the parent's own characters.
+        const charcount_t originalFullStringLength = string->IsSubstring() ?
+            static_cast<SubString*>(string)->originalFullStringLength : string->GetLength();
+
+        if (length <= MaxCopiedSliceLength && originalFullStringLength >= MinCopiedSliceParentLength && !PHASE_OFF1(SubStringCopyOutPhase))
+        {
+#ifdef PROFILE_STRINGS
+            StringProfiler::RecordSubStringCopyOut(scriptContext, length, originalFullStringLength);
+#endif
+            return JavascriptString::NewCopyBuffer(subString, length, scriptContext);
+        }
+
         void const * originalFullStringReference = string->GetOriginalStringReference();
 
 #if SYSINFO_IMAGE_BASE_AVAILABLE
@@ -45,7 +79,7 @@ namespace Js
             "Owning pointer for SubString must be static or GC pointer, property record bound by thread allocator, or character buffer in global string cache");
 #endif
 
-        return RecyclerNew(recycler, SubString, originalFullStringReference, subString, length, scriptContext);
+        return RecyclerNew(recycler, SubString, originalFullStringReference, originalFullStringLength, subString, length, scriptContext);
     }
 
     JavascriptString* SubString::New(const char16* string, charcount_t start, charcount_t length, ScriptContext *scriptContext)
@@ -59,7 +93,8 @@ namespace Js
         }
 
         Recycler* recycler = scriptContext->GetRecycler();
-        return RecyclerNew(recycler, SubString, string, string + start, length, scriptContext);
+        // The full length of the buffer isn't known here; it is at least start + length
+        return RecyclerNew(recycler, SubString, string, start + length, string + start, length, scriptContext);
     }
 
     const char16* SubString::GetSz()
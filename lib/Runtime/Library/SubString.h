@@ -9,9 +9,13 @@ namespace Js
     class SubString sealed : public JavascriptString
     {
         Field(void const *) originalFullStringReference;          // Only here to prevent recycler to free this buffer.
-        Field(void const *) unused; // Recycler would allocate this space anyway due to bucket sizing, so make it explicit
+        Field(charcount_t) originalFullStringLength;              // Length of the string whose buffer is kept alive; uses space the recycler would allocate anyway due to bucket sizing
 
-        SubString(void const * originalFullStringReference, const char16* subString, charcount_t length, ScriptContext *scriptContext);
+        SubString(void const * originalFullStringReference, charcount_t originalFullStringLength, const char16* subString, charcount_t length, ScriptContext *scriptContext);
+
+        // A view keeps its parent's whole buffer alive, so short slices of very large strings are copied out instead
+        static const charcount_t MaxCopiedSliceLength = 32;
+        static const charcount_t MinCopiedSliceParentLength = 64 * 1024;
 
     protected:
         DEFINE_VTABLE_CTOR(SubString, JavascriptString);
@@ -27,6 +27,7 @@ enum SymbolType : byte;
 namespace UnifiedRegex
 {
     struct RegexPattern;
+    struct Program;                                 // Used by ThreadContext.h
     template <typename T> class StandardChars;      // Used by ThreadContext.h
     struct TrigramAlphabet;
     struct RegexStacks;
@@ -295,6 +296,11 @@ namespace Js
 #endif
     typedef WeakPropertyIdMap<PropertyString> PropertyStringCacheMap;
     typedef WeakPropertyIdMap<JavascriptSymbol> SymbolCacheMap;
+#if ENABLE_WEAK_REFERENCE_REGIONS
+    typedef JsUtil::WeakReferenceRegionDictionary<hash_t, JavascriptString*> StringInternMap;
+#else
+    typedef JsUtil::WeakReferenceDictionary<hash_t, JavascriptString> StringInternMap;
+#endif
 
     extern const FrameDisplay NullFrameDisplay;
     extern const FrameDisplay StrictNullFrameDisplay;
@@ -508,6 +514,7 @@ enum tagDEBUG_EVENT_INFO_TYPE
 #include "Library/PropertyRecordUsageCache.h"
 #include "Library/PropertyString.h"
 #include "Library/SingleCharString.h"
+#include "Library/OneByteString.h"
 
 #include "Library/JavascriptTypedNumber.h"
 #include "Library/SparseArraySegment.h"